@@ -0,0 +1,381 @@
+/*
+ *  Copyright (C) 2025-2026 mod.io Pty Ltd. <https://mod.io>
+ *
+ *  This file is part of the mod.io ModioUGC Plugin.
+ *
+ *  Distributed under the MIT License. (See accompanying file LICENSE or
+ *   view online at <https://github.com/modio/modio-ue-modiougc/blob/main/LICENSE>)
+ *
+ */
+
+#include "UGC/CompositeUGCProvider.h"
+
+#include "Algo/StableSort.h"
+#include "Async/Async.h"
+#include "Misc/Paths.h"
+#include "ModioUGC.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+
+void UCompositeUGCProvider::AddSource(const FCompositeUGCProviderSource& Source)
+{
+	if (!Source.Provider.GetObject())
+	{
+		UE_LOG(LogModioUGC, Warning, TEXT("Cannot add a null provider to a composite UGC provider"));
+		return;
+	}
+
+	Sources.Add(Source);
+	Algo::StableSort(Sources, [](const FCompositeUGCProviderSource& A, const FCompositeUGCProviderSource& B) {
+		return A.Priority > B.Priority;
+	});
+}
+
+void UCompositeUGCProvider::RemoveSource(TScriptInterface<IUGCProvider> Provider)
+{
+	Sources.RemoveAll([&Provider](const FCompositeUGCProviderSource& Source) {
+		return Source.Provider.GetObject() == Provider.GetObject();
+	});
+}
+
+const TArray<FCompositeUGCProviderSource>& UCompositeUGCProvider::GetSources() const
+{
+	return Sources;
+}
+
+void UCompositeUGCProvider::InitializeProvider_Implementation(const FOnUGCProviderInitializedDelegate& Handler)
+{
+	if (PendingInitializations > 0)
+	{
+		UE_LOG(LogModioUGC, Warning, TEXT("Composite UGC provider is already initializing"));
+		Handler.ExecuteIfBound(false);
+		return;
+	}
+
+	InitializedHandler = Handler;
+	bAnySourceInitialized = false;
+
+	// Sources may complete synchronously, so the extra count keeps the result from being reported before every source
+	// has been started
+	const TArray<FCompositeUGCProviderSource> SourcesToInitialize = Sources;
+	PendingInitializations = SourcesToInitialize.Num() + 1;
+
+	FOnUGCProviderInitializedDelegate SourceHandler;
+	SourceHandler.BindDynamic(this, &UCompositeUGCProvider::OnSourceInitialized);
+	for (const FCompositeUGCProviderSource& Source : SourcesToInitialize)
+	{
+		UObject* Provider = Source.Provider.GetObject();
+		if (Provider && IUGCProvider::Execute_IsProviderEnabled(Provider))
+		{
+			IUGCProvider::Execute_InitializeProvider(Provider, SourceHandler);
+		}
+		else
+		{
+			FinishPendingInitialization();
+		}
+	}
+	FinishPendingInitialization();
+}
+
+void UCompositeUGCProvider::DeinitializeProvider_Implementation(const FOnUGCProviderDeinitializedDelegate& Handler)
+{
+	if (PendingDeinitializations > 0)
+	{
+		UE_LOG(LogModioUGC, Warning, TEXT("Composite UGC provider is already deinitializing"));
+		Handler.ExecuteIfBound(false);
+		return;
+	}
+
+	DeinitializedHandler = Handler;
+	bAllSourcesDeinitialized = true;
+
+	const TArray<FCompositeUGCProviderSource> SourcesToDeinitialize = Sources;
+	PendingDeinitializations = SourcesToDeinitialize.Num() + 1;
+
+	FOnUGCProviderDeinitializedDelegate SourceHandler;
+	SourceHandler.BindDynamic(this, &UCompositeUGCProvider::OnSourceDeinitialized);
+	for (const FCompositeUGCProviderSource& Source : SourcesToDeinitialize)
+	{
+		UObject* Provider = Source.Provider.GetObject();
+		if (Provider && IUGCProvider::Execute_IsProviderEnabled(Provider))
+		{
+			IUGCProvider::Execute_DeinitializeProvider(Provider, SourceHandler);
+		}
+		else
+		{
+			FinishPendingDeinitialization();
+		}
+	}
+	FinishPendingDeinitialization();
+}
+
+bool UCompositeUGCProvider::IsProviderEnabled_Implementation()
+{
+	for (const FCompositeUGCProviderSource& Source : Sources)
+	{
+		if (Source.Provider.GetObject() && IUGCProvider::Execute_IsProviderEnabled(Source.Provider.GetObject()))
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+FModUGCPathMap UCompositeUGCProvider::GetInstalledUGCPaths_Implementation()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UCompositeUGCProvider::GetInstalledUGCPaths);
+
+	// Sources that allow it are queried on the thread pool while the others are queried here
+	TArray<FModUGCPathMap> SourcePaths;
+	SourcePaths.SetNum(Sources.Num());
+	TArray<TFuture<void>> PendingQueries;
+	TArray<int32> GameThreadSourceIndices;
+	for (int32 SourceIndex = 0; SourceIndex < Sources.Num(); ++SourceIndex)
+	{
+		UObject* Provider = Sources[SourceIndex].Provider.GetObject();
+		if (!Provider || !IUGCProvider::Execute_IsProviderEnabled(Provider))
+		{
+			continue;
+		}
+
+		// Blueprint events must not be dispatched off the game thread, so only native classes are queried there, and
+		// through their native implementation. This also keeps Blueprint subclasses of native providers here
+		IUGCProvider* NativeProvider = Cast<IUGCProvider>(Provider);
+		const bool bNativeProvider =
+			NativeProvider && !Provider->GetClass()->HasAnyClassFlags(CLASS_CompiledFromBlueprint);
+		if (Sources[SourceIndex].bQueryOffGameThread && !bNativeProvider)
+		{
+			UE_LOG(LogModioUGC, Warning,
+				   TEXT("UGC source %s is not a native provider and is queried on the game thread instead"),
+				   *Provider->GetName());
+		}
+
+		if (Sources[SourceIndex].bQueryOffGameThread && bNativeProvider)
+		{
+			PendingQueries.Add(
+				Async(EAsyncExecution::ThreadPool, [NativeProvider, &Paths = SourcePaths[SourceIndex]]() {
+					Paths = NativeProvider->GetInstalledUGCPaths_Implementation();
+				}));
+		}
+		else
+		{
+			GameThreadSourceIndices.Add(SourceIndex);
+		}
+	}
+	for (const int32 SourceIndex : GameThreadSourceIndices)
+	{
+		UObject* Provider = Sources[SourceIndex].Provider.GetObject();
+		SourcePaths[SourceIndex] = IUGCProvider::Execute_GetInstalledUGCPaths(Provider);
+	}
+	for (TFuture<void>& PendingQuery : PendingQueries)
+	{
+		PendingQuery.Wait();
+	}
+
+	// Sources are sorted by priority, so the first source to provide a path or mod wins
+	FModUGCPathMap MergedPaths;
+	TSet<FString> SeenPaths;
+	TSet<FGenericModID> SeenModIDs;
+	int32 NumDuplicates = 0;
+	PathToSourceMap.Reset();
+	for (int32 SourceIndex = 0; SourceIndex < Sources.Num(); ++SourceIndex)
+	{
+		MergedPaths += MergeSourcePaths(SourcePaths[SourceIndex], Sources[SourceIndex].Provider.GetObject(), SeenPaths,
+										SeenModIDs, NumDuplicates);
+	}
+
+	UE_LOG(LogModioUGC, Log, TEXT("Merged %d UGC paths from %d sources (%d duplicates skipped)"),
+		   MergedPaths.PathToModIDMap.Num(), Sources.Num(), NumDuplicates);
+	return MergedPaths;
+}
+
+struct UCompositeUGCProvider::FAsyncEnumeration
+{
+	FOnUGCPathsBatchDelegate OnBatch;
+	TArray<TWeakObjectPtr<UObject>> Providers;
+	TArray<TArray<FModUGCPathMap>> PendingBatches;
+	TArray<bool> SourceCompleted;
+	int32 NextSourceIndex = 0;
+	TSet<FString> SeenPaths;
+	TSet<FGenericModID> SeenModIDs;
+	int32 NumDuplicates = 0;
+};
+
+void UCompositeUGCProvider::GetInstalledUGCPathsAsync(FOnUGCPathsBatchDelegate OnBatch)
+{
+	TSharedRef<FAsyncEnumeration> Enumeration = MakeShared<FAsyncEnumeration>();
+	Enumeration->OnBatch = MoveTemp(OnBatch);
+	Enumeration->PendingBatches.SetNum(Sources.Num());
+	Enumeration->SourceCompleted.Init(false, Sources.Num());
+	PathToSourceMap.Reset();
+
+	// Without sources no batch would ever arrive, so the enumeration completes right away
+	if (Sources.IsEmpty())
+	{
+		UE_LOG(LogModioUGC, Log, TEXT("No UGC sources to enumerate UGC paths from"));
+		Enumeration->OnBatch.ExecuteIfBound(FModUGCPathMap(), true);
+		return;
+	}
+
+	// Disabled sources are completed up front, as sources may complete synchronously when started below
+	TArray<int32> EnabledSourceIndices;
+	for (int32 SourceIndex = 0; SourceIndex < Sources.Num(); ++SourceIndex)
+	{
+		UObject* Provider = Sources[SourceIndex].Provider.GetObject();
+		Enumeration->Providers.Add(Provider);
+		if (Provider && IUGCProvider::Execute_IsProviderEnabled(Provider))
+		{
+			EnabledSourceIndices.Add(SourceIndex);
+		}
+		else
+		{
+			Enumeration->SourceCompleted[SourceIndex] = true;
+		}
+	}
+
+	for (const int32 SourceIndex : EnabledSourceIndices)
+	{
+		UObject* Provider = Sources[SourceIndex].Provider.GetObject();
+		FOnUGCPathsBatchDelegate SourceBatchHandler = FOnUGCPathsBatchDelegate::CreateWeakLambda(
+			this, [this, Enumeration, SourceIndex](const FModUGCPathMap& Batch, bool bIsFinalBatch) {
+				Enumeration->PendingBatches[SourceIndex].Add(Batch);
+				Enumeration->SourceCompleted[SourceIndex] = bIsFinalBatch;
+				ForwardEnumeratedBatches(Enumeration);
+			});
+
+		// Providers implemented in Blueprint only have the synchronous contract
+		if (IUGCProvider* NativeProvider = Cast<IUGCProvider>(Provider))
+		{
+			NativeProvider->GetInstalledUGCPathsAsync(MoveTemp(SourceBatchHandler));
+		}
+		else
+		{
+			SourceBatchHandler.Execute(IUGCProvider::Execute_GetInstalledUGCPaths(Provider), true);
+		}
+	}
+	ForwardEnumeratedBatches(Enumeration);
+}
+
+FModUGCPathMap UCompositeUGCProvider::MergeSourcePaths(const FModUGCPathMap& SourcePaths, UObject* Provider,
+													   TSet<FString>& SeenPaths, TSet<FGenericModID>& SeenModIDs,
+													   int32& NumDuplicates)
+{
+	TMap<FString, FGenericModID> MergedPaths;
+	for (const TPair<FString, FGenericModID>& UGCPath : SourcePaths.PathToModIDMap)
+	{
+		FString NormalizedPath = FPaths::ConvertRelativePathToFull(UGCPath.Key);
+		FPaths::NormalizeDirectoryName(NormalizedPath);
+		const bool bHasModID = UGCPath.Value != FGenericModID();
+		if (SeenPaths.Contains(NormalizedPath) || (bHasModID && SeenModIDs.Contains(UGCPath.Value)))
+		{
+			UE_LOG(LogModioUGC, Verbose, TEXT("Skipping UGC path %s, already provided by a higher priority source"),
+				   *UGCPath.Key);
+			++NumDuplicates;
+			continue;
+		}
+
+		SeenPaths.Add(MoveTemp(NormalizedPath));
+		if (bHasModID)
+		{
+			SeenModIDs.Add(UGCPath.Value);
+		}
+		MergedPaths.Add(UGCPath.Key, UGCPath.Value);
+		PathToSourceMap.Add(UGCPath.Key, Provider);
+	}
+	return FModUGCPathMap(MoveTemp(MergedPaths));
+}
+
+void UCompositeUGCProvider::ForwardEnumeratedBatches(const TSharedRef<FAsyncEnumeration>& Enumeration)
+{
+	const int32 NumSources = Enumeration->PendingBatches.Num();
+	while (Enumeration->NextSourceIndex < NumSources)
+	{
+		const int32 SourceIndex = Enumeration->NextSourceIndex;
+		FModUGCPathMap ReadyPaths;
+		for (const FModUGCPathMap& Batch : Enumeration->PendingBatches[SourceIndex])
+		{
+			ReadyPaths += MergeSourcePaths(Batch, Enumeration->Providers[SourceIndex].Get(), Enumeration->SeenPaths,
+										   Enumeration->SeenModIDs, Enumeration->NumDuplicates);
+		}
+		Enumeration->PendingBatches[SourceIndex].Reset();
+
+		const bool bSourceCompleted = Enumeration->SourceCompleted[SourceIndex];
+		if (bSourceCompleted)
+		{
+			++Enumeration->NextSourceIndex;
+		}
+
+		const bool bIsFinalBatch = Enumeration->NextSourceIndex == NumSources;
+		if (bIsFinalBatch)
+		{
+			UE_LOG(LogModioUGC, Log, TEXT("Enumerated UGC paths from %d sources (%d duplicates skipped)"), NumSources,
+				   Enumeration->NumDuplicates);
+		}
+		if (!ReadyPaths.PathToModIDMap.IsEmpty() || bIsFinalBatch)
+		{
+			Enumeration->OnBatch.ExecuteIfBound(ReadyPaths, bIsFinalBatch);
+		}
+
+		if (!bSourceCompleted)
+		{
+			return;
+		}
+	}
+}
+
+bool UCompositeUGCProvider::GetUGCLoadPriority_Implementation(const FString& UGCPath, FGenericModID ModID,
+															  int32& OutPriority)
+{
+	const TWeakObjectPtr<UObject>* Source = PathToSourceMap.Find(UGCPath);
+	UObject* Provider = Source ? Source->Get() : nullptr;
+	return Provider && IUGCProvider::Execute_GetUGCLoadPriority(Provider, UGCPath, ModID, OutPriority);
+}
+
+void UCompositeUGCProvider::ReportDamagedUGC_Implementation(const FString& UGCPath, FGenericModID ModID,
+															 const TArray<FString>& DamagedFiles)
+{
+	const TWeakObjectPtr<UObject>* Source = PathToSourceMap.Find(UGCPath);
+	if (UObject* Provider = Source ? Source->Get() : nullptr)
+	{
+		IUGCProvider::Execute_ReportDamagedUGC(Provider, UGCPath, ModID, DamagedFiles);
+	}
+}
+
+void UCompositeUGCProvider::OnSourceInitialized(bool bSuccess)
+{
+	bAnySourceInitialized |= bSuccess;
+	FinishPendingInitialization();
+}
+
+void UCompositeUGCProvider::OnSourceDeinitialized(bool bSuccess)
+{
+	bAllSourcesDeinitialized &= bSuccess;
+	FinishPendingDeinitialization();
+}
+
+void UCompositeUGCProvider::FinishPendingInitialization()
+{
+	if (--PendingInitializations > 0)
+	{
+		return;
+	}
+
+	UE_LOG(LogModioUGC, Log, TEXT("Composite UGC provider initialized %s"),
+		   bAnySourceInitialized ? TEXT("successfully") : TEXT("without any source"));
+	const FOnUGCProviderInitializedDelegate Handler = InitializedHandler;
+	InitializedHandler.Clear();
+	Handler.ExecuteIfBound(bAnySourceInitialized);
+}
+
+void UCompositeUGCProvider::FinishPendingDeinitialization()
+{
+	if (--PendingDeinitializations > 0)
+	{
+		return;
+	}
+
+	UE_LOG(LogModioUGC, Log, TEXT("Composite UGC provider deinitialized %s"),
+		   bAllSourcesDeinitialized ? TEXT("successfully") : TEXT("with failures"));
+	const FOnUGCProviderDeinitializedDelegate Handler = DeinitializedHandler;
+	DeinitializedHandler.Clear();
+	Handler.ExecuteIfBound(bAllSourcesDeinitialized);
+}
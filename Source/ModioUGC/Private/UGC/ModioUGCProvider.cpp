@@ -20,6 +20,7 @@
 #include "ModioUGCSettings.h"
 #include "Types/ModioInitializeOptions.h"
 #include "UGC/Types/GenericModID.h"
+#include "UGC/UGCSubsystem.h"
 
 void UModioUGCProvider::InitializeProvider_Implementation(const FOnUGCProviderInitializedDelegate& Delegate)
 {
@@ -37,6 +38,21 @@ void UModioUGCProvider::InitializeProvider_Implementation(const FOnUGCProviderIn
 				if (bSuccessfullyInitializedModio)
 				{
 					UE_LOG(LogModioUGC, Log, TEXT("Mod.io as UGC provider initialized"));
+
+					const UModioUGCSettings* UGCSettings = GetDefault<UModioUGCSettings>();
+					UModioSubsystem* Subsystem = GEngine->GetEngineSubsystem<UModioSubsystem>();
+					if (Subsystem && UGCSettings && UGCSettings->bMountUGCOnModManagementEvents)
+					{
+						const FModioErrorCode ModManagementError =
+							Subsystem->EnableModManagement(FOnModManagementDelegateFast::CreateWeakLambda(
+								this, [this](FModioModManagementEvent Event) { HandleModManagementEvent(Event); }));
+						bEnabledModManagement = !ModManagementError;
+						if (ModManagementError)
+						{
+							UE_LOG(LogModioUGC, Warning, TEXT("Failed to enable mod management for UGC events: %s"),
+								   *ModManagementError.GetErrorMessage());
+						}
+					}
 				}
 				else
 				{
@@ -58,6 +74,12 @@ void UModioUGCProvider::DeinitializeProvider_Implementation(const FOnUGCProvider
 #if MODIO_UGC_SUPPORTED_PLATFORM
 	if (UModioSubsystem* ModioSubsystem = GEngine->GetEngineSubsystem<UModioSubsystem>())
 	{
+		if (bEnabledModManagement)
+		{
+			ModioSubsystem->DisableModManagement();
+			bEnabledModManagement = false;
+		}
+
 		ModioSubsystem->ShutdownAsync(
 			FOnErrorOnlyDelegateFast::CreateWeakLambda(this, [Handler](FModioErrorCode ErrorCode) {
 				if (ErrorCode)
@@ -126,4 +148,54 @@ FModUGCPathMap UModioUGCProvider::GetInstalledUGCPaths_Implementation()
 	UE_LOG(LogModioUGC, Error, TEXT("Mod.io UGC provider not supported on this platform"));
 	return FModUGCPathMap();
 #endif
-}
\ No newline at end of file
+}
+
+void UModioUGCProvider::HandleModManagementEvent(const FModioModManagementEvent& Event)
+{
+#if MODIO_UGC_SUPPORTED_PLATFORM
+	UUGCSubsystem* UGCSubsystem = GEngine ? GEngine->GetEngineSubsystem<UUGCSubsystem>() : nullptr;
+	UModioSubsystem* ModioSubsystem = GEngine ? GEngine->GetEngineSubsystem<UModioSubsystem>() : nullptr;
+	if (!UGCSubsystem || !ModioSubsystem)
+	{
+		return;
+	}
+
+	EUGCModManagementEvent UGCEvent;
+	switch (Event.Event)
+	{
+		case EModioModManagementEventType::BeginInstall:
+			UGCEvent = EUGCModManagementEvent::BeginInstall;
+			break;
+		case EModioModManagementEventType::Installed:
+			UGCEvent = EUGCModManagementEvent::Installed;
+			break;
+		case EModioModManagementEventType::BeginUpdate:
+			UGCEvent = EUGCModManagementEvent::BeginUpdate;
+			break;
+		case EModioModManagementEventType::Updated:
+			UGCEvent = EUGCModManagementEvent::Updated;
+			break;
+		case EModioModManagementEventType::BeginUninstall:
+			UGCEvent = EUGCModManagementEvent::BeginUninstall;
+			break;
+		case EModioModManagementEventType::Uninstalled:
+			UGCEvent = EUGCModManagementEvent::Uninstalled;
+			break;
+		default:
+			return;
+	}
+
+	if (Event.Status &&
+		(UGCEvent == EUGCModManagementEvent::Installed || UGCEvent == EUGCModManagementEvent::Updated))
+	{
+		UE_LOG(LogModioUGC, Warning, TEXT("Mod management failed for mod '%lld': %s"), GetUnderlyingValue(Event.ID),
+			   *Event.Status.GetErrorMessage());
+	}
+
+	UGCSubsystem->HandleModManagementEvent(FGenericModID(GetUnderlyingValue(Event.ID)), UGCEvent, [&]() {
+		const TMap<FModioModID, FModioModCollectionEntry> InstalledMods = ModioSubsystem->QueryUserInstallations(true);
+		const FModioModCollectionEntry* InstalledMod = InstalledMods.Find(Event.ID);
+		return InstalledMod ? InstalledMod->GetPath() : FString();
+	});
+#endif
+}
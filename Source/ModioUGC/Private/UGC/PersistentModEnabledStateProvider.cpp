@@ -0,0 +1,306 @@
+/*
+ *  Copyright (C) 2025-2026 mod.io Pty Ltd. <https://mod.io>
+ *
+ *  This file is part of the mod.io ModioUGC Plugin.
+ *
+ *  Distributed under the MIT License. (See accompanying file LICENSE or
+ *   view online at <https://github.com/modio/modio-ue-modiougc/blob/main/LICENSE>)
+ *
+ */
+
+#include "UGC/PersistentModEnabledStateProvider.h"
+
+#include "Async/Async.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "ModioUGC.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+namespace PersistentModEnabledState
+{
+	/** Identifies the state file, followed by the format version */
+	constexpr uint32 FileMagic = 0x4D455354;
+	constexpr uint32 FileVersion = 1;
+} // namespace PersistentModEnabledState
+
+bool UPersistentModEnabledStateProvider::LoadState(const FString& FilePath)
+{
+	// Pending writes of the previous file must not overwrite what is about to be read
+	FlushPendingWrites();
+
+	bStateLoaded = true;
+	StateFilePath = FilePath.IsEmpty() ? GetDefaultStateFilePath() : FilePath;
+	ModEnabledStates.Reset();
+	TransactionOriginalStates.Reset();
+
+	TArray<uint8> FileData;
+	if (!FFileHelper::LoadFileToArray(FileData, *StateFilePath, FILEREAD_Silent))
+	{
+		return false;
+	}
+
+	FMemoryReader Reader(FileData);
+	uint32 Magic = 0;
+	uint32 Version = 0;
+	int32 NumStates = 0;
+	Reader << Magic << Version << NumStates;
+	if (Reader.IsError() || Magic != PersistentModEnabledState::FileMagic ||
+		Version != PersistentModEnabledState::FileVersion || NumStates < 0)
+	{
+		UE_LOG(LogModioUGC, Warning, TEXT("Discarding unreadable mod enabled state file %s"), *StateFilePath);
+		return false;
+	}
+
+	ModEnabledStates.Reserve(NumStates);
+	for (int32 Index = 0; Index < NumStates && !Reader.IsError(); ++Index)
+	{
+		FGenericModID ModID;
+		bool bEnabled = true;
+		Reader << ModID << bEnabled;
+		ModEnabledStates.Add(ModID, bEnabled);
+	}
+	if (Reader.IsError())
+	{
+		UE_LOG(LogModioUGC, Warning, TEXT("Discarding truncated mod enabled state file %s"), *StateFilePath);
+		ModEnabledStates.Reset();
+		return false;
+	}
+
+	UE_LOG(LogModioUGC, Verbose, TEXT("Loaded the enabled state of %d mods from %s"), ModEnabledStates.Num(),
+		   *StateFilePath);
+	return true;
+}
+
+TMap<FGenericModID, bool> UPersistentModEnabledStateProvider::GetModsEnabled(const TArray<FGenericModID>& ModIDs)
+{
+	EnsureStateLoaded();
+
+	TMap<FGenericModID, bool> Result;
+	Result.Reserve(ModIDs.Num());
+	for (const FGenericModID& ModID : ModIDs)
+	{
+		const bool* bEnabled = ModEnabledStates.Find(ModID);
+		Result.Add(ModID, bEnabled ? *bEnabled : bEnabledByDefault);
+	}
+	return Result;
+}
+
+TMap<FGenericModID, bool> UPersistentModEnabledStateProvider::GetAllModEnabledStates()
+{
+	EnsureStateLoaded();
+	return ModEnabledStates;
+}
+
+int32 UPersistentModEnabledStateProvider::SetModsEnabled(const TMap<FGenericModID, bool>& NewStates)
+{
+	BeginTransaction();
+	const int32 NumPreviousChanges = TransactionOriginalStates.Num();
+	for (const TPair<FGenericModID, bool>& NewState : NewStates)
+	{
+		SetModEnabled_Internal(NewState.Key, NewState.Value);
+	}
+	const int32 NumChanged = TransactionOriginalStates.Num() - NumPreviousChanges;
+	CommitTransaction();
+	return NumChanged;
+}
+
+void UPersistentModEnabledStateProvider::BeginTransaction()
+{
+	EnsureStateLoaded();
+	++TransactionDepth;
+}
+
+void UPersistentModEnabledStateProvider::CommitTransaction()
+{
+	CommitTransaction_Internal(true);
+}
+
+TArray<FModEnabledStateChange> UPersistentModEnabledStateProvider::CommitTransaction_Internal(bool bBroadcast)
+{
+	if (TransactionDepth <= 0)
+	{
+		UE_LOG(LogModioUGC, Warning, TEXT("CommitTransaction called without a matching BeginTransaction"));
+		return {};
+	}
+	if (--TransactionDepth > 0)
+	{
+		return {};
+	}
+
+	// Mods toggled back to their original state within the transaction did not change
+	TArray<FModEnabledStateChange> Changes;
+	Changes.Reserve(TransactionOriginalStates.Num());
+	for (const TPair<FGenericModID, bool>& OriginalState : TransactionOriginalStates)
+	{
+		const bool* bEnabled = ModEnabledStates.Find(OriginalState.Key);
+		const bool bNewEnabled = bEnabled ? *bEnabled : bEnabledByDefault;
+		if (bNewEnabled != OriginalState.Value)
+		{
+			FModEnabledStateChange& Change = Changes.AddDefaulted_GetRef();
+			Change.ModID = OriginalState.Key;
+			Change.bEnabled = bNewEnabled;
+		}
+	}
+	TransactionOriginalStates.Reset();
+
+	if (Changes.IsEmpty())
+	{
+		return Changes;
+	}
+
+	ScheduleWrite();
+	if (bBroadcast)
+	{
+		OnModEnabledStatesChanged.Broadcast(Changes);
+	}
+	return Changes;
+}
+
+void UPersistentModEnabledStateProvider::FlushPendingWrites()
+{
+	if (WriteTask.IsValid())
+	{
+		WriteTask.Wait();
+		WriteTask.Reset();
+	}
+}
+
+void UPersistentModEnabledStateProvider::AddModEnabledStatesChangeHandler(
+	const FModEnabledStatesChangeHandler& Handler)
+{
+	OnModEnabledStatesChanged.AddUnique(Handler);
+}
+
+void UPersistentModEnabledStateProvider::RemoveModEnabledStatesChangeHandler(
+	const FModEnabledStatesChangeHandler& Handler)
+{
+	OnModEnabledStatesChanged.Remove(Handler);
+}
+
+FString UPersistentModEnabledStateProvider::GetDefaultStateFilePath()
+{
+	return FPaths::ProjectSavedDir() / TEXT("ModioUGC") / TEXT("ModEnabledState.bin");
+}
+
+void UPersistentModEnabledStateProvider::BeginDestroy()
+{
+	if (TransactionDepth > 0)
+	{
+		UE_LOG(LogModioUGC, Warning, TEXT("Mod enabled state provider destroyed with an open transaction"));
+		TransactionDepth = 1;
+		CommitTransaction();
+	}
+	FlushPendingWrites();
+	Super::BeginDestroy();
+}
+
+bool UPersistentModEnabledStateProvider::NativeQueryIsModEnabled(FGenericModID ModID)
+{
+	EnsureStateLoaded();
+	const bool* bEnabled = ModEnabledStates.Find(ModID);
+	return bEnabled ? *bEnabled : bEnabledByDefault;
+}
+
+bool UPersistentModEnabledStateProvider::NativeRequestModEnabledStateChange(FGenericModID ID, bool bNewEnabledState)
+{
+	// The caller of the interface broadcasts the change
+	BeginTransaction();
+	SetModEnabled_Internal(ID, bNewEnabledState);
+	CommitTransaction_Internal(false);
+	return true;
+}
+
+TArray<FModEnabledStateChange> UPersistentModEnabledStateProvider::NativeRequestModEnabledStateChanges(
+	const TMap<FGenericModID, bool>& NewStates)
+{
+	// The caller of the interface broadcasts the changes
+	BeginTransaction();
+	for (const TPair<FGenericModID, bool>& NewState : NewStates)
+	{
+		SetModEnabled_Internal(NewState.Key, NewState.Value);
+	}
+	return CommitTransaction_Internal(false);
+}
+
+void UPersistentModEnabledStateProvider::EnsureStateLoaded()
+{
+	if (!bStateLoaded)
+	{
+		LoadState(FString());
+	}
+}
+
+void UPersistentModEnabledStateProvider::SetModEnabled_Internal(FGenericModID ModID, bool bEnabled)
+{
+	// Mods left in their default state are not stored, so unchanged defaults are not persisted
+	const bool* bCurrentEnabled = ModEnabledStates.Find(ModID);
+	const bool bPreviousEnabled = bCurrentEnabled ? *bCurrentEnabled : bEnabledByDefault;
+	if (bPreviousEnabled != bEnabled)
+	{
+		TransactionOriginalStates.FindOrAdd(ModID, bPreviousEnabled);
+		ModEnabledStates.Add(ModID, bEnabled);
+	}
+}
+
+void UPersistentModEnabledStateProvider::ScheduleWrite()
+{
+	TArray<uint8> FileData;
+	FMemoryWriter Writer(FileData);
+	uint32 Magic = PersistentModEnabledState::FileMagic;
+	uint32 Version = PersistentModEnabledState::FileVersion;
+	int32 NumStates = ModEnabledStates.Num();
+	Writer << Magic << Version << NumStates;
+	for (const TPair<FGenericModID, bool>& State : ModEnabledStates)
+	{
+		FGenericModID ModID = State.Key;
+		bool bEnabled = State.Value;
+		Writer << ModID << bEnabled;
+	}
+
+	{
+		FScopeLock Lock(&PendingWrite->Lock);
+		PendingWrite->Data = MoveTemp(FileData);
+		PendingWrite->FilePath = StateFilePath;
+		PendingWrite->bHasData = true;
+		// A running writer picks up the new data once it finishes the current write
+		if (PendingWrite->bWriterRunning)
+		{
+			return;
+		}
+		PendingWrite->bWriterRunning = true;
+	}
+
+	WriteTask = Async(EAsyncExecution::ThreadPool,
+					  [PendingWrite = PendingWrite]() { WritePendingData(PendingWrite); });
+}
+
+void UPersistentModEnabledStateProvider::WritePendingData(
+	const TSharedRef<FPendingWrite, ESPMode::ThreadSafe>& PendingWrite)
+{
+	while (true)
+	{
+		TArray<uint8> FileData;
+		FString FilePath;
+		{
+			FScopeLock Lock(&PendingWrite->Lock);
+			if (!PendingWrite->bHasData)
+			{
+				PendingWrite->bWriterRunning = false;
+				return;
+			}
+			FileData = MoveTemp(PendingWrite->Data);
+			FilePath = PendingWrite->FilePath;
+			PendingWrite->bHasData = false;
+		}
+
+		// Write next to the state file and move it in place so an interrupted write never leaves a truncated file
+		const FString TempFilePath = FilePath + TEXT(".tmp");
+		if (!FFileHelper::SaveArrayToFile(FileData, *TempFilePath) ||
+			!IFileManager::Get().Move(*FilePath, *TempFilePath, true, true))
+		{
+			UE_LOG(LogModioUGC, Warning, TEXT("Failed to write mod enabled state file %s"), *FilePath);
+		}
+	}
+}
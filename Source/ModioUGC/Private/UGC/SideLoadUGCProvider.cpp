@@ -9,8 +9,12 @@
  */
 
 #include "UGC/SideLoadUGCProvider.h"
-#include "HAL/FileManager.h"
+#include "Async/Async.h"
 #include "Misc/Paths.h"
+#include "ModioUGCSettings.h"
+#include "UGC/Utilities/SideLoadUGCScanner.h"
+
+USideLoadUGCProvider::USideLoadUGCProvider() : Scanner(MakeShared<FSideLoadUGCScanner, ESPMode::ThreadSafe>()) {}
 
 void USideLoadUGCProvider::InitializeProvider_Implementation(const FOnUGCProviderInitializedDelegate& Handler)
 {
@@ -31,20 +35,43 @@ bool USideLoadUGCProvider::IsProviderEnabled_Implementation()
 
 FModUGCPathMap USideLoadUGCProvider::GetInstalledUGCPaths_Implementation()
 {
-	TMap<FString, FGenericModID> UGCPathsToModIDs;
-
-	// Scan folder for mods
-	const FString BaseModsPath = FPaths::ProjectDir() / TEXT("Modio");
-	const FString ModsPathSearch = BaseModsPath / TEXT("*");
+	const UModioUGCSettings* UGCSettings = GetDefault<UModioUGCSettings>();
+	return Scanner->Scan(GetSideLoadRoots(), UGCSettings ? UGCSettings->SideLoadModIDFileName : FString());
+}
 
-	IFileManager& FileManager = IFileManager::Get();
-	TArray<FString> OutFolders;
-	FileManager.FindFiles(OutFolders, *ModsPathSearch, false, true);
+void USideLoadUGCProvider::GetInstalledUGCPathsAsync(FOnUGCPathsBatchDelegate OnBatch)
+{
+	const UModioUGCSettings* UGCSettings = GetDefault<UModioUGCSettings>();
+	Async(EAsyncExecution::ThreadPool, [WeakThis = TWeakObjectPtr<USideLoadUGCProvider>(this), Scanner = Scanner,
+										Roots = GetSideLoadRoots(),
+										ModIDFileName = UGCSettings ? UGCSettings->SideLoadModIDFileName : FString(),
+										OnBatch]() {
+		FModUGCPathMap UGCPathMap = Scanner->Scan(Roots, ModIDFileName);
+		AsyncTask(ENamedThreads::GameThread, [WeakThis, OnBatch, UGCPathMap = MoveTemp(UGCPathMap)]() {
+			if (WeakThis.IsValid())
+			{
+				OnBatch.ExecuteIfBound(UGCPathMap, true);
+			}
+		});
+	});
+}
 
-	for (const FString& Folder : OutFolders)
+TArray<FString> USideLoadUGCProvider::GetSideLoadRoots()
+{
+	TArray<FString> Roots;
+	if (const UModioUGCSettings* UGCSettings = GetDefault<UModioUGCSettings>())
 	{
-		UGCPathsToModIDs.Add(BaseModsPath / Folder, FGenericModID());
+		for (const FString& Root : UGCSettings->SideLoadUGCRoots)
+		{
+			// Relative roots are relative to the project directory
+			FString AbsoluteRoot = FPaths::ConvertRelativePathToFull(FPaths::ProjectDir(), Root);
+			FPaths::NormalizeDirectoryName(AbsoluteRoot);
+			Roots.AddUnique(MoveTemp(AbsoluteRoot));
+		}
 	}
-
-	return FModUGCPathMap(MoveTemp(UGCPathsToModIDs));
+	if (Roots.IsEmpty())
+	{
+		Roots.Add(FPaths::ConvertRelativePathToFull(FPaths::ProjectDir() / TEXT("Modio")));
+	}
+	return Roots;
 }
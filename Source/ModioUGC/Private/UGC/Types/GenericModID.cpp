@@ -17,4 +17,9 @@ FGenericModID::FGenericModID() : ModID(INDEX_NONE) {}
 uint32 GetTypeHash(const FGenericModID& ModId)
 {
 	return FCrc::MemCrc32(&ModId.ModID, sizeof(int64));
-}
\ No newline at end of file
+}
+
+FArchive& operator<<(FArchive& Ar, FGenericModID& ModId)
+{
+	return Ar << ModId.ModID;
+}
@@ -11,17 +11,25 @@
 #include "UGC/Types/UGCPackage.h"
 
 #include "AssetRegistry/AssetRegistryState.h"
+#include "Async/ParallelFor.h"
 #include "Engine/AssetManager.h"
+#include "HAL/FileManager.h"
 #include "HAL/PlatformFileManager.h"
 #include "IPlatformFilePak.h"
 #include "Interfaces/IPluginManager.h"
 #include "Misc/App.h"
 #include "Misc/ConfigCacheIni.h"
-#include "Misc/EngineVersionComparison.h"
+#include "Misc/Paths.h"
 #include "ModioUGC.h"
-#include "ShaderCodeLibrary.h"
+#include "ModioUGCSettings.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
 #include "UGC/Types/UGC_Metadata.h"
 #include "UGC/Utilities/PakFileHelpers.h"
+#include "UGC/Utilities/UGCContentVerifier.h"
+#include "UGC/Utilities/UGCFileIndex.h"
+#include "UGC/Utilities/UGCPakContentsCapture.h"
+#include "UGC/Utilities/UGCShaderLibraryRegistry.h"
+#include "UGC/Utilities/UGCWarmRemountCache.h"
 #include "ModioSubsystem.h"
 #include "Engine/Engine.h"
 
@@ -59,39 +67,102 @@ bool FScopedPlatformPakFileOverride::IsValid() const
 	return PakPlatformFile != nullptr;
 }
 
-FPakPlatformFile* FScopedPlatformPakFileOverride::operator->() const
+FPakPlatformFile* FScopedPlatformPakFileOverride::Get() const
 {
 	checkf(IsValid(), TEXT("Attempting to access an invalid PakPlatformFile"));
 	return PakPlatformFile;
 }
 
-FUGCPackage::FUGCPackage(const TSharedRef<IPlugin> Plugin, TOptional<FGenericModID> ModID /*= {}*/)
-	: AssociatedPlugin(Plugin),
-	  ModID(ModID)
+FPakPlatformFile* FScopedPlatformPakFileOverride::operator->() const
 {
-	FScopedPlatformPakFileOverride PlatformPakFile {};
+	return Get();
+}
+
+namespace UGCPackageInfoCache
+{
+	FCriticalSection Lock;
 
-	DescriptorPath = Plugin->GetDescriptorFileName();
-	PackagePath = *Plugin->GetMountedAssetPath().LeftChop(1);
-	ContentPath = *Plugin->GetContentDir();
+	/** Interned package infos, keyed by the unsanitized descriptor path of their plugin */
+	TMap<FName, TWeakPtr<const FUGCPackageInfo>> Infos;
+} // namespace UGCPackageInfoCache
+
+TSharedRef<const FUGCPackageInfo> FUGCPackageInfo::Intern(const TSharedRef<IPlugin>& Plugin,
+														  TOptional<FGenericModID> ModID)
+{
+	const FName CacheKey(Plugin->GetDescriptorFileName());
+	FScopeLock ScopeLock(&UGCPackageInfoCache::Lock);
+	if (const TWeakPtr<const FUGCPackageInfo>* CachedInfo = UGCPackageInfoCache::Infos.Find(CacheKey))
+	{
+		TSharedPtr<const FUGCPackageInfo> PinnedInfo = CachedInfo->Pin();
+		// The plugin manager creates a new plugin object when the plugin list is refreshed, which invalidates the info
+		if (PinnedInfo.IsValid() && PinnedInfo->AssociatedPlugin == Plugin && PinnedInfo->ModID == ModID)
+		{
+			return PinnedInfo.ToSharedRef();
+		}
+	}
+
+	TSharedRef<FUGCPackageInfo> NewInfo = MakeShared<FUGCPackageInfo>();
+	NewInfo->AssociatedPlugin = Plugin;
+	NewInfo->ModID = ModID;
+
+	FString DescriptorPath = Plugin->GetDescriptorFileName();
+	FString PackagePath = Plugin->GetMountedAssetPath().LeftChop(1);
+	NewInfo->ContentPath = Plugin->GetContentDir();
 	if (UModioSubsystem* ModioSubsystem = GEngine->GetEngineSubsystem<UModioSubsystem>())
 	{
-		if (UObject* PortalInterfaceObject = ModioSubsystem->GetPortalInterfaceObject()) 
+		if (UObject* PortalInterfaceObject = ModioSubsystem->GetPortalInterfaceObject())
 		{
 			DescriptorPath = IModioPortalInterface::Execute_SanitizeFilePath(PortalInterfaceObject, DescriptorPath);
 			PackagePath = IModioPortalInterface::Execute_SanitizeFilePath(PortalInterfaceObject, PackagePath);
-			ContentPath = IModioPortalInterface::Execute_SanitizeFilePath(PortalInterfaceObject, ContentPath);
+			NewInfo->ContentPath =
+				IModioPortalInterface::Execute_SanitizeFilePath(PortalInterfaceObject, NewInfo->ContentPath);
+		}
+	}
+	NewInfo->DescriptorPath = FName(DescriptorPath);
+	NewInfo->PackagePath = FName(PackagePath);
+	NewInfo->EngineVersion = Plugin->GetDescriptor().EngineVersion;
+	NewInfo->Author = Plugin->GetDescriptor().CreatedBy;
+	NewInfo->Description = Plugin->GetDescriptor().Description;
+	NewInfo->FriendlyName = Plugin->GetDescriptor().FriendlyName;
+
+	// Drop entries whose packages have all been released so the cache does not grow with every refresh
+	for (auto It = UGCPackageInfoCache::Infos.CreateIterator(); It; ++It)
+	{
+		if (!It->Value.IsValid())
+		{
+			It.RemoveCurrent();
 		}
 	}
-	EngineVersion = *Plugin->GetDescriptor().EngineVersion;
-	Author = *Plugin->GetDescriptor().CreatedBy;
-	Description = *Plugin->GetDescriptor().Description;
-	FriendlyName = *Plugin->GetDescriptor().FriendlyName;
+	UGCPackageInfoCache::Infos.Add(CacheKey, NewInfo);
+
+	return NewInfo;
+}
+
+const TSharedRef<const FUGCPackageInfo>& FUGCPackageInfo::GetEmpty()
+{
+	static const TSharedRef<const FUGCPackageInfo> EmptyInfo = MakeShared<FUGCPackageInfo>();
+	return EmptyInfo;
+}
+
+FUGCPackage::FUGCPackage()
+	: Info(FUGCPackageInfo::GetEmpty()),
+	  State(MakeShared<FUGCPackageState>())
+{
+}
+
+FUGCPackage::FUGCPackage(const TSharedRef<IPlugin> Plugin, TOptional<FGenericModID> ModID /*= {}*/,
+						 int32 InLoadPriority /*= 0*/, bool bDeferLoadAssets /*= false*/)
+	: Info(FUGCPackageInfo::Intern(Plugin, ModID)),
+	  State(MakeShared<FUGCPackageState>())
+{
+	FScopedPlatformPakFileOverride PlatformPakFile {};
+	State->LoadPriority = InLoadPriority;
+	const FString& FriendlyName = Info->FriendlyName;
 
 	TArray<FString> FoundPaks;
 	FPakFileSearchVisitor PakVisitor(FoundPaks);
 	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
-	FString PathToSearch = ContentPath;
+	FString PathToSearch = Info->ContentPath;
 	UE_LOG(LogModioUGC, Verbose, TEXT("Searching directory for pak files %s"), *PathToSearch);
 	PlatformFile.IterateDirectoryRecursively(*PathToSearch, PakVisitor);
 
@@ -99,7 +170,7 @@ FUGCPackage::FUGCPackage(const TSharedRef<IPlugin> Plugin, TOptional<FGenericMod
 	{
 		UE_LOG(LogModioUGC, Error, TEXT("UGC `%s` does not contain any pak files within %s."), *FriendlyName,
 			   *PathToSearch);
-		MountState = EUGCPackageMountState::EUPMS_Unmounted;
+		State->MountState = EUGCPackageMountState::EUPMS_Unmounted;
 		return;
 	}
 	else
@@ -109,30 +180,227 @@ FUGCPackage::FUGCPackage(const TSharedRef<IPlugin> Plugin, TOptional<FGenericMod
 	}
 	FString MountPoint = Plugin->GetMountedAssetPath();
 
-	for (const FString& PakPath : FoundPaks)
+	// Directory iteration order is platform dependent, so sort to keep the mount order deterministic
+	FoundPaks.Sort();
+
+	// Paks unchanged since the package was last unmounted were already verified, and their registry and file list can
+	// be reused
+	TOptional<FUGCWarmRemountEntry> WarmEntry;
+	const UModioUGCSettings* UGCSettings = GetDefault<UModioUGCSettings>();
+	if (UGCSettings && UGCSettings->bEnableUGCWarmRemountCache)
+	{
+		WarmEntry = FUGCWarmRemountCache::Get().Take(Info->DescriptorPath, FoundPaks);
+	}
+
+	if (WarmEntry.IsSet())
+	{
+		UE_LOG(LogModioUGC, Verbose, TEXT("UGC `%s` is remounted from the warm remount cache."), *FriendlyName);
+		State->LoadedAssetRegistryState = WarmEntry->RegistryState;
+	}
+	else if (!VerifyPakFiles(FoundPaks))
+	{
+		UE_LOG(LogModioUGC, Error, TEXT("UGC `%s` failed content verification and will not be mounted."),
+			   *FriendlyName);
+		State->MountState = EUGCPackageMountState::EUPMS_Unmounted;
+		return;
+	}
+
+	MountPakFiles(PlatformPakFile.Get(), FoundPaks, MountPoint, WarmEntry.IsSet() ? WarmEntry->FileIndex : nullptr);
+
+	if (!bDeferLoadAssets)
+	{
+		FinishMount();
+	}
+}
+
+void FUGCPackage::PreloadAssetRegistry()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FUGCPackage::PreloadAssetRegistry);
+	// A registry retained by the warm remount cache is used as-is, and without mounted paks there is nothing to load
+	if (State->LoadedAssetRegistryState.IsValid() || State->MountedPakFilePaths.IsEmpty())
 	{
-		UE_LOG(LogModioUGC, VeryVerbose, TEXT("Attempting to mount UGC pak file %s at %s"), *PakPath, *MountPoint);
-		if (PlatformPakFile->Mount(*PakPath, 4, *MountPoint))
+		return;
+	}
+
+	FAssetRegistryState PluginAssetRegistry;
+	const FString AssetRegistryFilePath = GetAssetRegistryFilePath();
+	if (FAssetRegistryState::LoadFromDisk(*AssetRegistryFilePath, FAssetRegistryLoadOptions(), PluginAssetRegistry))
+	{
+		State->LoadedAssetRegistryState = MakeShared<class FAssetRegistryState>(MoveTemp(PluginAssetRegistry));
+	}
+}
+
+bool FUGCPackage::FinishMount()
+{
+	if (State->MountedPakFilePaths.IsEmpty() || !LoadAssets())
+	{
+		return false;
+	}
+
+	State->MountState = EUGCPackageMountState::EUPMS_Mounted;
+	State->MountedFootprintBytes = State->PakIndexBytes;
+	if (State->FileIndex.IsValid())
+	{
+		State->MountedFootprintBytes += State->FileIndex->GetAllocatedSize();
+	}
+	if (State->LoadedAssetRegistryState.IsValid())
+	{
+		State->MountedFootprintBytes += State->LoadedAssetRegistryState->GetAllocatedSize();
+	}
+	return true;
+}
+
+FString FUGCPackage::GetAssetRegistryFilePath() const
+{
+	return Info->PackagePath.ToString() / TEXT("AssetRegistry.bin");
+}
+
+bool FUGCPackage::VerifyPakFiles(const TArray<FString>& PakPaths) const
+{
+	const UModioUGCSettings* UGCSettings = GetDefault<UModioUGCSettings>();
+	if (!UGCSettings || !UGCSettings->bVerifyUGCContentBeforeMount)
+	{
+		return true;
+	}
+
+	TRACE_CPUPROFILER_EVENT_SCOPE(FUGCPackage::VerifyPakFiles);
+	FUGCContentVerifier& Verifier = FUGCContentVerifier::Get();
+	bool bAllVerified = true;
+	TArray<FString> ContentFiles;
+	for (const FString& PakPath : PakPaths)
+	{
+		// IoStore containers hold the actual package data of IoStore packaged UGC, so they are verified with the pak
+		ContentFiles.Append(FUGCContentVerifier::GetContentFilesForPak(PakPath));
+	}
+	for (const FString& ContentFile : ContentFiles)
+	{
+		// Each file is already hashed in parallel chunks, so files are verified one after another
+		switch (Verifier.VerifyFile(ContentFile))
 		{
-			MountedPakFilePaths.Add(PakPath);
-			UE_LOG(LogModioUGC, VeryVerbose, TEXT("Mounted UGC pak file %s at %s"), *PakPath, *MountPoint);
+			case EUGCContentVerificationResult::Verified:
+				break;
+			case EUGCContentVerificationResult::NoStoredDigest:
+				if (UGCSettings->bRequireUGCContentDigest)
+				{
+					UE_LOG(LogModioUGC, Error, TEXT("UGC content file %s has no stored digest"), *ContentFile);
+					bAllVerified = false;
+				}
+				break;
+			default:
+				bAllVerified = false;
+				break;
 		}
-		else
+	}
+	Verifier.SaveCache();
+
+	return bAllVerified;
+}
+
+/**
+ * Serialized index size of a pak file plus the size of its IoStore table of contents, which both stay resident while
+ * the pak is mounted
+ */
+static int64 GetPakIndexSize(const FString& PakPath, const FPakInfo& PakInfo)
+{
+	const int64 TocSize = IFileManager::Get().FileSize(*FPaths::ChangeExtension(PakPath, TEXT("utoc")));
+	return PakInfo.IndexSize + FMath::Max<int64>(TocSize, 0);
+}
+
+void FUGCPackage::MountPakFilesInOrder(FPakPlatformFile* PakPlatformFile, const TArray<FString>& PakPaths,
+									   const FString& MountPoint, uint32 PakReadOrder, bool bPreloadInParallel,
+									   TArray<bool>& OutMounted, TArray<int64>& OutPakIndexSizes)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FUGCPackage::MountPakFilesInOrder);
+	OutMounted.Init(false, PakPaths.Num());
+	OutPakIndexSizes.Init(0, PakPaths.Num());
+
+	// FPakPlatformFile::Mount is not safe to call concurrently, as it broadcasts the pak mounted delegates from the
+	// calling thread. Only the footer and index reads, which dominate mounting from cold storage, run in parallel
+	TArray<FPakInfo> PakInfos;
+	PakInfos.SetNum(PakPaths.Num());
+	TArray<bool> IndexPreloaded;
+	IndexPreloaded.Init(false, PakPaths.Num());
+	if (bPreloadInParallel)
+	{
+		ParallelFor(PakPaths.Num(), [&](int32 PakIndex) {
+			IndexPreloaded[PakIndex] = PreloadPakIndex(PakPaths[PakIndex], PakInfos[PakIndex]);
+		});
+	}
+
+	for (int32 PakIndex = 0; PakIndex < PakPaths.Num(); ++PakIndex)
+	{
+		const FString& PakPath = PakPaths[PakIndex];
+		if (bPreloadInParallel && !IndexPreloaded[PakIndex])
+		{
+			UE_LOG(LogModioUGC, Warning, TEXT("UGC pak file %s has no readable index and will not be mounted"),
+				   *PakPath);
+			continue;
+		}
+
+		UE_LOG(LogModioUGC, VeryVerbose, TEXT("Attempting to mount UGC pak file %s at %s with read order %u"), *PakPath,
+			   *MountPoint, PakReadOrder);
+		OutMounted[PakIndex] = PakPlatformFile->Mount(*PakPath, PakReadOrder, *MountPoint);
+		if (!OutMounted[PakIndex])
+		{
+			continue;
+		}
+
+		// Read once here so that memory reports do not have to read every pak footer again
+		int64 PakSize = 0;
+		if (IndexPreloaded[PakIndex] || ReadPakFooter(PakPath, PakInfos[PakIndex], PakSize))
 		{
-			UE_LOG(LogModioUGC, VeryVerbose, TEXT("Failed to mount UGC pak file %s at %s"), *PakPath, *MountPoint);
+			OutPakIndexSizes[PakIndex] = GetPakIndexSize(PakPath, PakInfos[PakIndex]);
 		}
 	}
+}
+
+void FUGCPackage::MountPakFiles(FPakPlatformFile* PakPlatformFile, const TArray<FString>& PakPaths,
+								const FString& MountPoint, TSharedPtr<const FUGCFileIndex> RetainedFileIndex)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FUGCPackage::MountPakFiles);
+	const double StartTime = FPlatformTime::Seconds();
 
-	if (LoadAssets())
+	const UModioUGCSettings* UGCSettings = GetDefault<UModioUGCSettings>();
+	const bool bPreloadInParallel = UGCSettings && UGCSettings->bMountPakFilesInParallel && PakPaths.Num() > 1;
+	if (!RetainedFileIndex.IsValid())
+	{
+		FUGCPakContentsCapture::Get().BeginCapture(PakPaths);
+	}
+	TArray<bool> MountResults;
+	TArray<int64> PakIndexSizes;
+	MountPakFilesInOrder(PakPlatformFile, PakPaths, MountPoint, GetPakReadOrder(), bPreloadInParallel, MountResults,
+						 PakIndexSizes);
+	State->FileIndex = RetainedFileIndex.IsValid()
+						   ? RetainedFileIndex
+						   : MakeShared<const FUGCFileIndex>(FUGCPakContentsCapture::Get().EndCapture(PakPaths));
+
+	for (int32 PakIndex = 0; PakIndex < PakPaths.Num(); ++PakIndex)
 	{
-		MountState = EUGCPackageMountState::EUPMS_Mounted;
+		if (MountResults[PakIndex])
+		{
+			State->MountedPakFilePaths.Add(PakPaths[PakIndex]);
+			State->PakIndexBytes += PakIndexSizes[PakIndex];
+			UE_LOG(LogModioUGC, VeryVerbose, TEXT("Mounted UGC pak file %s at %s"), *PakPaths[PakIndex], *MountPoint);
+		}
+		else
+		{
+			UE_LOG(LogModioUGC, VeryVerbose, TEXT("Failed to mount UGC pak file %s at %s"), *PakPaths[PakIndex],
+				   *MountPoint);
+		}
 	}
+
+	UE_LOG(LogModioUGC, Verbose,
+		   TEXT("Mounted %d of %d pak files (%d files, %llu bytes indexed) for UGC `%s` in %.2f ms (%s)"),
+		   State->MountedPakFilePaths.Num(), PakPaths.Num(), State->FileIndex->Num(),
+		   static_cast<uint64>(State->FileIndex->GetAllocatedSize()), *Info->FriendlyName,
+		   (FPlatformTime::Seconds() - StartTime) * 1000.0,
+		   bPreloadInParallel ? TEXT("parallel index preload") : TEXT("serial"));
 }
 
 bool FUGCPackage::operator==(const FUGCPackage& Other) const
 {
-	// All other fields on the package are derived from these members
-	return ModID == Other.ModID && AssociatedPlugin == Other.AssociatedPlugin;
+	// All other fields of the package info are derived from these members
+	return Info->ModID == Other.Info->ModID && Info->AssociatedPlugin == Other.Info->AssociatedPlugin;
 }
 
 bool FUGCPackage::operator!=(const FUGCPackage& Other) const
@@ -140,46 +408,78 @@ bool FUGCPackage::operator!=(const FUGCPackage& Other) const
 	return !(*this == Other);
 }
 
+uint32 FUGCPackage::GetPakReadOrder() const
+{
+	// Pak read orders are unsigned, so clamp negative priorities to the lowest read order
+	const int64 ReadOrder = static_cast<int64>(DefaultPakReadOrder) + State->LoadPriority;
+	return static_cast<uint32>(FMath::Clamp<int64>(ReadOrder, 0, MAX_uint32));
+}
+
+bool FUGCPackage::LoadOrderPredicate(const FUGCPackage& A, const FUGCPackage& B)
+{
+	return LoadOrderPredicate(A.State->LoadPriority, A.Info->DescriptorPath, B.State->LoadPriority,
+							  B.Info->DescriptorPath);
+}
+
+bool FUGCPackage::LoadOrderPredicate(int32 LoadPriorityA, FName DescriptorPathA, int32 LoadPriorityB,
+									 FName DescriptorPathB)
+{
+	if (LoadPriorityA != LoadPriorityB)
+	{
+		return LoadPriorityA > LoadPriorityB;
+	}
+	return DescriptorPathA.Compare(DescriptorPathB) < 0;
+}
+
 bool FUGCPackage::UnloadAssets()
 {
+	TRACE_CPUPROFILER_EVENT_SCOPE(FUGCPackage::UnloadAssets);
+
 	// Mark all loaded assets from this UGC package for garbage collection
-	if (LoadedAssetRegistryState.IsValid())
+	if (State->LoadedAssetRegistryState.IsValid())
 	{
-		TArray<FAssetData> AllAssets;
-		LoadedAssetRegistryState->GetAllAssets({}, AllAssets);
+		// Assets are walked per package rather than per asset, so packages holding several assets are only visited
+		// once. Package names are looked up directly as FNames to avoid converting each one to a string.
+		TArray<FName> PackageNames;
+		State->LoadedAssetRegistryState->GetPackageNames(PackageNames);
+
+		TArray<UPackage*> LoadedPackages;
+		LoadedPackages.Reserve(PackageNames.Num());
+		for (const FName PackageName : PackageNames)
+		{
+			if (UPackage* Package = FindObjectFast<UPackage>(nullptr, PackageName))
+			{
+				LoadedPackages.Add(Package);
+			}
+		}
 
-		UE_LOG(LogModioUGC, Verbose, TEXT("Marking %d assets from UGC package '%s' for garbage collection"),
-			   AllAssets.Num(), *FriendlyName);
+		UE_LOG(LogModioUGC, Verbose,
+			   TEXT("Marking %d loaded packages (of %d packages, %d assets) from UGC package '%s' for garbage "
+					"collection"),
+			   LoadedPackages.Num(), PackageNames.Num(), State->LoadedAssetRegistryState->GetNumAssets(),
+			   *Info->FriendlyName);
 
-		for (const FAssetData& AssetData : AllAssets)
+		for (UPackage* Package : LoadedPackages)
 		{
-			// Get the package name
-			FName PackageName = AssetData.PackageName;
-
-			// Try to find the loaded package
-			UPackage* Package = FindPackage(nullptr, *PackageName.ToString());
-			if (Package)
-			{
-				// Clear flags that prevent garbage collection
-				Package->ClearFlags(RF_Standalone | RF_Public);
-				Package->MarkAsGarbage();
-
-				// Also mark all objects within the package
-				ForEachObjectWithPackage(
-					Package,
-					[](UObject* Object) {
-						if (Object && Object->IsValidLowLevel())
-						{
-							Object->ClearFlags(RF_Standalone | RF_Public);
-							Object->MarkAsGarbage();
-						}
-						return true;
-					},
-					true, RF_NoFlags, EInternalObjectFlags::None);
+			// Clear flags that prevent garbage collection
+			Package->ClearFlags(RF_Standalone | RF_Public);
+			Package->MarkAsGarbage();
+
+			// Also mark all objects within the package
+			ForEachObjectWithPackage(
+				Package,
+				[](UObject* Object) {
+					if (Object && Object->IsValidLowLevel())
+					{
+						Object->ClearFlags(RF_Standalone | RF_Public);
+						Object->MarkAsGarbage();
+					}
+					return true;
+				},
+				true, RF_NoFlags, EInternalObjectFlags::None);
 
-				UE_LOG(LogModioUGC, VeryVerbose, TEXT("Marked package '%s' and its objects for garbage collection"),
-					   *PackageName.ToString());
-			}
+			UE_LOG(LogModioUGC, VeryVerbose, TEXT("Marked package '%s' and its objects for garbage collection"),
+				   *Package->GetName());
 		}
 	}
 
@@ -202,51 +502,59 @@ bool FUGCPackage::LoadAssets()
 
 bool FUGCPackage::LoadAssetRegistry()
 {
-	const FString AssetRegistryFilePath = PackagePath / TEXT("AssetRegistry.bin");
+	const FString AssetRegistryFilePath = GetAssetRegistryFilePath();
 	FAssetRegistryState PluginAssetRegistry;
-	if (FAssetRegistryState::LoadFromDisk(*AssetRegistryFilePath, FAssetRegistryLoadOptions(), PluginAssetRegistry))
+	// A registry retained by the warm remount cache describes the same paks, and a preloaded one was just loaded from
+	// them, so neither needs to be loaded again
+	const bool bRetainedRegistry = State->LoadedAssetRegistryState.IsValid();
+	if (bRetainedRegistry ||
+		FAssetRegistryState::LoadFromDisk(*AssetRegistryFilePath, FAssetRegistryLoadOptions(), PluginAssetRegistry))
 	{
-		LoadedAssetRegistryState = MakeShared<class FAssetRegistryState>(MoveTemp(PluginAssetRegistry));
+		if (!bRetainedRegistry)
+		{
+			State->LoadedAssetRegistryState = MakeShared<class FAssetRegistryState>(MoveTemp(PluginAssetRegistry));
+		}
 
 		// For debugging purposes, log out all the package names and assets within this UGC package.
 		if (UE_LOG_ACTIVE(LogModioUGC, VeryVerbose))
 		{
 			TArray<FName> PackageNames;
-			LoadedAssetRegistryState->GetPackageNames(PackageNames);
+			State->LoadedAssetRegistryState->GetPackageNames(PackageNames);
 			if (PackageNames.IsEmpty())
 			{
-				UE_LOG(LogModioUGC, Error, TEXT("UGC plugin %s AssetRegistry has no packages"), *FriendlyName);
+				UE_LOG(LogModioUGC, Error, TEXT("UGC plugin %s AssetRegistry has no packages"), *Info->FriendlyName);
 				return false;
 			}
 
 			for (const auto& PN : PackageNames)
 			{
 				UE_LOG(LogModioUGC, VeryVerbose, TEXT("UGC plugin %s: AssetRegistry contains package %s"),
-					   *FriendlyName, *PN.ToString());
+					   *Info->FriendlyName, *PN.ToString());
 			}
 
 			TArray<FAssetData> AssetList;
-			LoadedAssetRegistryState->GetAllAssets({}, AssetList);
+			State->LoadedAssetRegistryState->GetAllAssets({}, AssetList);
 
 			if (AssetList.IsEmpty())
 			{
-				UE_LOG(LogModioUGC, Error, TEXT("UGC plugin %s AssetRegistry has no assets"), *FriendlyName);
+				UE_LOG(LogModioUGC, Error, TEXT("UGC plugin %s AssetRegistry has no assets"), *Info->FriendlyName);
 				return false;
 			}
 
 			for (const FAssetData& Asset : AssetList)
 			{
-				UE_LOG(LogModioUGC, VeryVerbose, TEXT("UGC plugin %s: AssetRegistry contains asset %s"), *FriendlyName,
-					   *Asset.GetFullName());
+				UE_LOG(LogModioUGC, VeryVerbose, TEXT("UGC plugin %s: AssetRegistry contains asset %s"),
+					   *Info->FriendlyName, *Asset.GetFullName());
 			}
 
 			PackageNames.Empty();
 			AssetList.Empty();
 		}
 
-		UE_LOG(LogModioUGC, Verbose, TEXT("AssetRegistry for %s loaded from %s. Contains %i assets."), *FriendlyName,
-			   *AssetRegistryFilePath, LoadedAssetRegistryState.Get()->GetNumAssets());
-		IAssetRegistry::GetChecked().AppendState(*LoadedAssetRegistryState.Get());
+		UE_LOG(LogModioUGC, Verbose, TEXT("AssetRegistry for %s loaded from %s. Contains %i assets."),
+			   *Info->FriendlyName, *AssetRegistryFilePath, State->LoadedAssetRegistryState.Get()->GetNumAssets());
+		FindShadowedPackages();
+		IAssetRegistry::GetChecked().AppendState(*State->LoadedAssetRegistryState.Get());
 	}
 	else
 	{
@@ -257,18 +565,60 @@ bool FUGCPackage::LoadAssetRegistry()
 	return true;
 }
 
+void FUGCPackage::FindShadowedPackages()
+{
+	State->ShadowedPackageNames.Reset();
+
+	// Packages under the mount root of this UGC package cannot exist anywhere else, so only packages it places in other
+	// roots (e.g. "/Game/") need to be looked up
+	TStringBuilder<256> MountRoot;
+	MountRoot << Info->PackagePath << TEXT('/');
+
+	TArray<FName> PackageNames;
+	State->LoadedAssetRegistryState->GetPackageNames(PackageNames);
+	IAssetRegistry& AssetRegistry = IAssetRegistry::GetChecked();
+	TStringBuilder<256> PackageNameString;
+	for (const FName PackageName : PackageNames)
+	{
+		PackageNameString.Reset();
+		PackageName.AppendString(PackageNameString);
+		if (PackageNameString.ToView().StartsWith(MountRoot.ToView(), ESearchCase::IgnoreCase))
+		{
+			continue;
+		}
+
+		TArray<FAssetData> ExistingAssets;
+		if (AssetRegistry.GetAssetsByPackageName(PackageName, ExistingAssets, true) && !ExistingAssets.IsEmpty())
+		{
+			State->ShadowedPackageNames.Add(PackageName);
+		}
+	}
+
+	if (!State->ShadowedPackageNames.IsEmpty())
+	{
+		UE_LOG(LogModioUGC, Warning, TEXT("UGC `%s` replaces %d packages that are already registered (e.g. %s)"),
+			   *Info->FriendlyName, State->ShadowedPackageNames.Num(), *State->ShadowedPackageNames[0].ToString());
+	}
+}
+
 bool FUGCPackage::RegisterPrimaryAssets()
 {
-	if (!AssociatedPlugin)
+	if (!Info->AssociatedPlugin)
 	{
 		UE_LOG(LogModioUGC, Error, TEXT("Unable to register primary assets on a null plugin."));
 		return false;
 	}
 
+	const FString PackagePath = Info->PackagePath.ToString();
+
 	// e.g. "/RedSpaceship/UUGC_Metadata.UUGC_Metadata"
 	FString PreferredDataPath = PackagePath / UUGC_Metadata::GetDefaultAssetName();
-	PackageMetadata = LoadMetadata(PreferredDataPath);
-	if (!PackageMetadata.IsValid())
+	// Metadata stays loaded while a package is hidden, so showing it again does not reload it
+	if (!State->PackageMetadata.IsValid())
+	{
+		State->PackageMetadata = LoadMetadata(PreferredDataPath);
+	}
+	if (!State->PackageMetadata.IsValid())
 	{
 		UE_LOG(LogModioUGC, Warning,
 			   TEXT("UGC does not contain metadata. This content cannot be registered to the AssetManager, but can "
@@ -276,22 +626,22 @@ bool FUGCPackage::RegisterPrimaryAssets()
 	}
 	else
 	{
-		PackageMetadata->DebugLogValues();
+		State->PackageMetadata->DebugLogValues();
 
 		bool bUseIoStore = false;
 		GConfig->GetBool(TEXT("/Script/UnrealEd.ProjectPackagingSettings"), TEXT("bUseIoStore"), bUseIoStore, GGameIni);
 		
-		if (bUseIoStore != PackageMetadata->bIoStoreEnabled)
+		if (bUseIoStore != State->PackageMetadata->bIoStoreEnabled)
 		{
 			UE_LOG(
 				LogModioUGC, Error,
 				TEXT("bUseIoStore values mismatch between UGC (%s) and Base Game (%s). This UGC will not be mounted."),
-				(PackageMetadata->bIoStoreEnabled ? TEXT("TRUE") : TEXT("FALSE")),
+				(State->PackageMetadata->bIoStoreEnabled ? TEXT("TRUE") : TEXT("FALSE")),
 				(bUseIoStore ? TEXT("TRUE") : TEXT("FALSE")));
 			return false;
 		}
 
-		if (PackageMetadata->PrimaryAssetTypesToScan.Num() == 0)
+		if (State->PackageMetadata->PrimaryAssetTypesToScan.Num() == 0)
 		{
 			UE_LOG(LogModioUGC, Warning,
 				   TEXT("UGC metadata hs no primary asset types assigned, so nothing will be registered to the "
@@ -304,7 +654,7 @@ bool FUGCPackage::RegisterPrimaryAssets()
 		const bool bForceSynchronousScan = !LocalAssetRegistry.IsLoadingAssets();
 
 		// Use our metadata to scan our list of primary asset types
-		for (FPrimaryAssetTypeInfo PrimaryTypeInfo : PackageMetadata->PrimaryAssetTypesToScan)
+		for (FPrimaryAssetTypeInfo PrimaryTypeInfo : State->PackageMetadata->PrimaryAssetTypesToScan)
 		{
 			// This function also fills out runtime data on the copy
 			if (!LocalAssetManager.ShouldScanPrimaryAssetType(PrimaryTypeInfo))
@@ -379,33 +729,36 @@ bool FUGCPackage::RegisterPrimaryAssets()
 	return true;
 }
 
-bool FUGCPackage::UnregisterPrimaryAssets()
+bool FUGCPackage::UnregisterPrimaryAssets(bool bReleaseResidentData /*= true*/)
 {
-	if (!AssociatedPlugin)
+	if (!Info->AssociatedPlugin)
 	{
 		UE_LOG(LogModioUGC, Error, TEXT("Unable to unregister primary assets on a null plugin."));
 		return false;
 	}
 
-	if (PackageMetadata == nullptr)
+	const FString PackagePath = Info->PackagePath.ToString();
+
+	if (State->PackageMetadata == nullptr)
 	{
 		UE_LOG(LogModioUGC, Warning, TEXT("Unable to unregister primary assets with no metadata."));
 		return true; // Still return true as UGC without metadata is still valid
 	}
 
-	if (!PackageMetadata->IsValidLowLevel())
+	if (!State->PackageMetadata->IsValidLowLevel())
 	{
 		UE_LOG(LogModioUGC, Error, TEXT("Unable to unregister primary assets with invalid metadata."));
 		return false;
 	}
 
-	for (FPrimaryAssetTypeInfo PrimaryTypeInfo : PackageMetadata->PrimaryAssetTypesToScan)
+	for (FPrimaryAssetTypeInfo PrimaryTypeInfo : State->PackageMetadata->PrimaryAssetTypesToScan)
 	{
 		UAssetManager& LocalAssetManager = UAssetManager::Get();
 		IAssetRegistry& LocalAssetRegistry = LocalAssetManager.GetAssetRegistry();
 
-		// This function also fills out runtime data on the copy
-		if (!LocalAssetManager.ShouldScanPrimaryAssetType(PrimaryTypeInfo))
+		// This function also fills out runtime data on the copy. The scan paths of hidden packages are already removed
+		if (!LocalAssetManager.ShouldScanPrimaryAssetType(PrimaryTypeInfo) ||
+			State->MountState == EUGCPackageMountState::EUPMS_Hidden)
 		{
 			continue;
 		}
@@ -450,15 +803,40 @@ bool FUGCPackage::UnregisterPrimaryAssets()
 		}
 	}
 
-	UnloadMetadata();
-	LoadedAssetRegistryState.Reset();
+	if (bReleaseResidentData)
+	{
+		UnloadMetadata();
+		State->LoadedAssetRegistryState.Reset();
+	}
+
+	return true;
+}
+
+bool FUGCPackage::Hide()
+{
+	if (State->MountState != EUGCPackageMountState::EUPMS_Mounted || !UnregisterPrimaryAssets(false))
+	{
+		return false;
+	}
+
+	State->MountState = EUGCPackageMountState::EUPMS_Hidden;
+	return true;
+}
 
+bool FUGCPackage::Show()
+{
+	if (State->MountState != EUGCPackageMountState::EUPMS_Hidden || !RegisterPrimaryAssets())
+	{
+		return false;
+	}
+
+	State->MountState = EUGCPackageMountState::EUPMS_Mounted;
 	return true;
 }
 
 bool FUGCPackage::LoadShaderLibrary() const
 {
-	if (!AssociatedPlugin)
+	if (!Info->AssociatedPlugin)
 	{
 		UE_LOG(LogModioUGC, Error, TEXT("Unable to load shader library on a null plugin."));
 		return false;
@@ -473,25 +851,16 @@ bool FUGCPackage::LoadShaderLibrary() const
 
 	// Always try to load the shader library if it exists in the UGC pak
 	// The shader system will handle whether to use shared or embedded shaders
-#if UE_VERSION_NEWER_THAN(5, 3, 0)
-	UE_LOG(LogModioUGC, Verbose, TEXT("Opening shader library for plugin '%s'"),
-		*AssociatedPlugin->GetName());
-	FShaderCodeLibrary::OpenPluginShaderLibrary(*AssociatedPlugin);
-#else
-	if (AssociatedPlugin->CanContainContent() && AssociatedPlugin->IsEnabled())
-	{
-		UE_LOG(LogModioUGC, Verbose, TEXT("Opening shader library at '%s'"),
-			*AssociatedPlugin->GetContentDir());
-		FShaderCodeLibrary::OpenLibrary(AssociatedPlugin->GetName(), AssociatedPlugin->GetContentDir());
-	}
-#endif
+	const UModioUGCSettings* UGCSettings = GetDefault<UModioUGCSettings>();
+	const bool bLazy = UGCSettings && UGCSettings->bLazyOpenUGCShaderLibraries;
+	FUGCShaderLibraryRegistry::Get().Register(Info->AssociatedPlugin.ToSharedRef(), bLazy);
 
 	return true;
 }
 
 bool FUGCPackage::UnloadShaderLibrary() const
 {
-	if (!AssociatedPlugin)
+	if (!Info->AssociatedPlugin)
 	{
 		UE_LOG(LogModioUGC, Error, TEXT("Unable to unload shader library on a null plugin."));
 		return false;
@@ -504,7 +873,7 @@ bool FUGCPackage::UnloadShaderLibrary() const
 		return true;
 	}
 
-	FShaderCodeLibrary::CloseLibrary(AssociatedPlugin->GetName());
+	FUGCShaderLibraryRegistry::Get().Unregister(Info->AssociatedPlugin.ToSharedRef());
 
 	return true;
 }
@@ -514,14 +883,15 @@ TWeakObjectPtr<UUGC_Metadata> FUGCPackage::LoadMetadata(const FString& InPath)
 {
 	if (FPackageName::DoesPackageExist(FPackageName::ObjectPathToPackageName(InPath)))
 	{
-		MetadataDataHandle = UAssetManager::Get().GetStreamableManager().RequestAsyncLoad(FSoftObjectPath(InPath));
+		State->MetadataDataHandle =
+			UAssetManager::Get().GetStreamableManager().RequestAsyncLoad(FSoftObjectPath(InPath));
 
-		if (MetadataDataHandle.IsValid())
+		if (State->MetadataDataHandle.IsValid())
 		{
 			// Synchronous for now
-			MetadataDataHandle->WaitUntilComplete(0.0f, /*bLogErrors*/ false);
+			State->MetadataDataHandle->WaitUntilComplete(0.0f, /*bLogErrors*/ false);
 
-			UObject* LoadedObj = MetadataDataHandle->GetLoadedAsset();
+			UObject* LoadedObj = State->MetadataDataHandle->GetLoadedAsset();
 			UUGC_Metadata* LoadedData = Cast<UUGC_Metadata>(LoadedObj);
 
 			if (LoadedData && LoadedData->IsValidLowLevel())
@@ -541,14 +911,14 @@ TWeakObjectPtr<UUGC_Metadata> FUGCPackage::LoadMetadata(const FString& InPath)
 
 void FUGCPackage::UnloadMetadata()
 {
-	if (PackageMetadata.IsValid())
+	if (State->PackageMetadata.IsValid())
 	{
-		PackageMetadata.Reset();
+		State->PackageMetadata.Reset();
 	}
 
-	if (MetadataDataHandle.IsValid())
+	if (State->MetadataDataHandle.IsValid())
 	{
-		MetadataDataHandle->ReleaseHandle();
-		MetadataDataHandle.Reset();
+		State->MetadataDataHandle->ReleaseHandle();
+		State->MetadataDataHandle.Reset();
 	}
 }
@@ -14,15 +14,60 @@
 
 bool UUGCLibrary::GetModID(const FUGCPackage& UGCPackage, FGenericModID& ModID)
 {
-	if (UGCPackage.ModID.IsSet())
+	if (UGCPackage.GetModID().IsSet())
 	{
-		ModID = UGCPackage.ModID.GetValue();
+		ModID = UGCPackage.GetModID().GetValue();
 		return true;
 	}
 
 	return false;
 }
 
+FString UUGCLibrary::GetPackagePath(const FUGCPackage& UGCPackage)
+{
+	return UGCPackage.GetInfo().PackagePath.ToString();
+}
+
+FString UUGCLibrary::GetContentPath(const FUGCPackage& UGCPackage)
+{
+	return UGCPackage.GetInfo().ContentPath;
+}
+
+FString UUGCLibrary::GetEngineVersion(const FUGCPackage& UGCPackage)
+{
+	return UGCPackage.GetInfo().EngineVersion;
+}
+
+FString UUGCLibrary::GetAuthor(const FUGCPackage& UGCPackage)
+{
+	return UGCPackage.GetInfo().Author;
+}
+
+FString UUGCLibrary::GetDescription(const FUGCPackage& UGCPackage)
+{
+	return UGCPackage.GetInfo().Description;
+}
+
+FString UUGCLibrary::GetFriendlyName(const FUGCPackage& UGCPackage)
+{
+	return UGCPackage.GetFriendlyName();
+}
+
+TArray<FString> UUGCLibrary::GetMountedPakFilePaths(const FUGCPackage& UGCPackage)
+{
+	return UGCPackage.GetState().MountedPakFilePaths;
+}
+
+int32 UUGCLibrary::GetLoadPriority(const FUGCPackage& UGCPackage)
+{
+	return UGCPackage.GetState().LoadPriority;
+}
+
+EUGCPackageMountState UUGCLibrary::GetMountState(const FUGCPackage& UGCPackage)
+{
+	return UGCPackage.GetMountState();
+}
+
 bool UUGCLibrary::EqualEqual_GenericModID(const FGenericModID& A, const FGenericModID& B)
 {
 	return A == B;
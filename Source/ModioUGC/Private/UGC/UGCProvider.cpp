@@ -0,0 +1,33 @@
+/*
+ *  Copyright (C) 2025-2026 mod.io Pty Ltd. <https://mod.io>
+ *
+ *  This file is part of the mod.io ModioUGC Plugin.
+ *
+ *  Distributed under the MIT License. (See accompanying file LICENSE or
+ *   view online at <https://github.com/modio/modio-ue-modiougc/blob/main/LICENSE>)
+ *
+ */
+
+#include "UGC/UGCProvider.h"
+
+void IUGCProvider::GetInstalledUGCPathsAsync(FOnUGCPathsBatchDelegate OnBatch)
+{
+	const FModUGCPathMap UGCPathMap = Execute_GetInstalledUGCPaths(_getUObject());
+	OnBatch.ExecuteIfBound(UGCPathMap, true);
+}
+
+TFuture<FModUGCPathMap> IUGCProvider::GetAllInstalledUGCPathsAsync()
+{
+	TSharedRef<TPromise<FModUGCPathMap>> Promise = MakeShared<TPromise<FModUGCPathMap>>();
+	TSharedRef<FModUGCPathMap> AllPaths = MakeShared<FModUGCPathMap>();
+	TFuture<FModUGCPathMap> Future = Promise->GetFuture();
+	GetInstalledUGCPathsAsync(FOnUGCPathsBatchDelegate::CreateLambda(
+		[Promise, AllPaths](const FModUGCPathMap& Batch, bool bIsFinalBatch) {
+			*AllPaths += Batch;
+			if (bIsFinalBatch)
+			{
+				Promise->SetValue(MoveTemp(*AllPaths));
+			}
+		}));
+	return Future;
+}
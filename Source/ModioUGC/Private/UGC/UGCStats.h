@@ -0,0 +1,15 @@
+/*
+ *  Copyright (C) 2025-2026 mod.io Pty Ltd. <https://mod.io>
+ *
+ *  This file is part of the mod.io ModioUGC Plugin.
+ *
+ *  Distributed under the MIT License. (See accompanying file LICENSE or
+ *   view online at <https://github.com/modio/modio-ue-modiougc/blob/main/LICENSE>)
+ *
+ */
+
+#pragma once
+
+#include "Stats/Stats.h"
+
+DECLARE_STATS_GROUP(TEXT("ModioUGC"), STATGROUP_ModioUGC, STATCAT_Advanced);
@@ -18,17 +18,25 @@
 	#include "ModioSettings.h"
 #endif
 #include "Algo/AllOf.h"
+#include "Algo/Sort.h"
 #include "AssetRegistry/AssetRegistryState.h"
 #include "Async/Async.h"
+#include "Async/ParallelFor.h"
+#include "Containers/Ticker.h"
 #include "Dom/JsonObject.h"
 #include "Engine/AssetManager.h"
 #include "Engine/Engine.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
 #include "HAL/PlatformFileManager.h"
 #include "IPlatformFilePak.h"
 #include "Interfaces/IPluginManager.h"
+#include "Misc/CoreDelegates.h"
 #include "Misc/EngineVersion.h"
 #include "Misc/FileHelper.h"
+#include "Misc/ScopeRWLock.h"
 #include "ModioUGCSettings.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
 #include "Serialization/JsonReader.h"
 #include "Serialization/JsonSerializer.h"
 #include "Serialization/MemoryReader.h"
@@ -39,6 +47,14 @@
 #include "UGC/Types/UGC_Metadata.h"
 #include "UGC/UGCProvider.h"
 #include "UGC/Utilities/PakFileHelpers.h"
+#include "UGC/Utilities/UGCContentVerifier.h"
+#include "UGC/Utilities/UGCDependencyGraph.h"
+#include "UGC/Utilities/UGCFileIndex.h"
+#include "UGC/Utilities/UGCLeakDetector.h"
+#include "UGC/Utilities/UGCPakPrefetcher.h"
+#include "UGC/Utilities/UGCShaderLibraryRegistry.h"
+#include "UGC/Utilities/UGCWarmRemountCache.h"
+#include "UObject/UObjectIterator.h"
 #include "ModioSubsystem.h"
 
 bool GetModMountPoint(TSharedPtr<IPlugin> Plugin, FString& RootPath, FString& ContentPath)
@@ -57,6 +73,62 @@ bool GetModMountPoint(TSharedPtr<IPlugin> Plugin, FString& RootPath, FString& Co
 	return true;
 }
 
+/**
+ * A discovered UGC plugin waiting to be loaded, used to sort plugins into load order before mounting
+ */
+struct FUGCLoadCandidate
+{
+	TSharedRef<IPlugin> Plugin;
+	TOptional<FGenericModID> ModID;
+	int32 LoadPriority = 0;
+	FName DescriptorPath;
+};
+
+/**
+ * Whether a plugin is UGC that LoadUGC would mount, as opposed to an engine or project plugin that is disabled
+ */
+bool IsUGCPlugin(const TSharedRef<IPlugin>& Plugin)
+{
+	return Plugin->GetLoadedFrom() == EPluginLoadedFrom::Project && Plugin->GetDescriptor().Category == "UGC";
+}
+
+bool GetDescriptorLoadPriority(const FString& DescriptorPath, int32& OutPriority)
+{
+	FString DescriptorContent;
+	if (!FFileHelper::LoadFileToString(DescriptorContent, *DescriptorPath))
+	{
+		return false;
+	}
+
+	TSharedPtr<FJsonObject> JsonObject;
+	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(DescriptorContent);
+	if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
+	{
+		return false;
+	}
+
+	return JsonObject->TryGetNumberField(TEXT("UGCLoadPriority"), OutPriority);
+}
+
+static FAutoConsoleCommandWithOutputDevice GUGCMemReportCommand(
+	TEXT("ugc.memreport"), TEXT("Dumps the memory used by each registered UGC package"),
+	FConsoleCommandWithOutputDeviceDelegate::CreateLambda([](FOutputDevice& Ar) {
+		if (const UUGCSubsystem* UGCSubsystem = GEngine ? GEngine->GetEngineSubsystem<UUGCSubsystem>() : nullptr)
+		{
+			UGCSubsystem->DumpUGCMemoryReport(Ar);
+		}
+	}));
+
+void RetainForWarmRemount(const FUGCPackage& Package)
+{
+	const UModioUGCSettings* UGCSettings = GetDefault<UModioUGCSettings>();
+	if (UGCSettings && UGCSettings->bEnableUGCWarmRemountCache)
+	{
+		const SIZE_T BudgetBytes = static_cast<SIZE_T>(FMath::Max(UGCSettings->UGCWarmRemountCacheSizeMB, 1)) << 20;
+		FUGCWarmRemountCache::Get().Retain(Package, BudgetBytes);
+	}
+}
+
 void UUGCSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
 	Super::Initialize(Collection);
@@ -71,6 +143,19 @@ void UUGCSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 	}
 
 	const UModioUGCSettings* UGCSettings = GetDefault<UModioUGCSettings>();
+	if (UGCSettings && UGCSettings->bEnableUGCResidencyManager)
+	{
+		SyncLoadHandle = FCoreDelegates::OnSyncLoadPackage.AddUObject(this, &UUGCSubsystem::OnPackageLoadRequested);
+		AsyncLoadHandle = FCoreDelegates::OnAsyncLoadPackage.AddUObject(this, &UUGCSubsystem::OnPackageLoadRequested);
+	}
+
+	if (UGCSettings && UGCSettings->bEnableBackgroundUGCVerification)
+	{
+		LastUGCActivityTime = FPlatformTime::Seconds();
+		BackgroundVerificationTickHandle = FTSTicker::GetCoreTicker().AddTicker(
+			FTickerDelegate::CreateUObject(this, &UUGCSubsystem::TickBackgroundVerification), 1.0f);
+	}
+
 	if (UGCProvider.GetObject() && IUGCProvider::Execute_IsProviderEnabled(UGCProvider.GetObject()) && UGCSettings &&
 		UGCSettings->bAutoInitializeUGCProvider)
 	{
@@ -114,15 +199,6 @@ void UUGCSubsystem::OnUGCProviderInitialized(bool bSuccess)
 	if (bSuccess)
 	{
 		UE_LOG(LogModioUGC, Log, TEXT("UGC provider initialized"));
-#if UE_VERSION_OLDER_THAN(5, 3, 0)
-		FCoreDelegates::OnPakFileMounted2
-#else
-		FCoreDelegates::GetOnPakFileMounted2()
-#endif
-			.AddLambda([](const IPakFile& Pakfile) {
-				FPakFileContentsIterator Iterator {Pakfile.PakGetPakFilename()};
-				Pakfile.PakVisitPrunedFilenames(Iterator);
-			});
 
 		// In editor we'll only refresh UGC when starting PIE to prevent premature scanning during editor startup.
 		#if WITH_EDITOR
@@ -146,6 +222,13 @@ void UUGCSubsystem::Deinitialize()
 {
 	Super::Deinitialize();
 #if UGC_SUPPORTED_PLATFORM
+	FCoreDelegates::OnSyncLoadPackage.Remove(SyncLoadHandle);
+	FCoreDelegates::OnAsyncLoadPackage.Remove(AsyncLoadHandle);
+
+	FTSTicker::GetCoreTicker().RemoveTicker(BackgroundVerificationTickHandle);
+	// Stops the running pass and waits for the verification thread to exit
+	BackgroundVerifier.Reset();
+
 	if (GEngine && !IsEngineExitRequested() && UGCProvider.GetObject() &&
 		IUGCProvider::Execute_IsProviderEnabled(UGCProvider.GetObject()))
 	{
@@ -225,6 +308,9 @@ void UUGCSubsystem::RefreshUGC()
 		return;
 	}
 
+	// Batches of an asynchronous refresh still in flight are superseded by this refresh
+	++AsyncRefreshSerial;
+
 	{
 		TArray<FUGCPackage> InternalUGCPackages = UGCPackages.Array();
 
@@ -232,202 +318,725 @@ void UUGCSubsystem::RefreshUGC()
 		{
 			UnloadUGC(UGCPackage);
 		}
+
+		// Every installed package is mounted again below, and evicted again if it doesn't fit the budget
+		ResidencyTracker.EmptyEvicted();
 	}
 
 	const FModUGCPathMap UGCPathMap = IUGCProvider::Execute_GetInstalledUGCPaths(UGCProvider.GetObject());
-	for (const TPair<FString, FGenericModID>& UGCPath : UGCPathMap.PathToModIDMap)
+	CachedInstalledUGCPaths = UGCPathMap;
+	const bool bWasAnyUGCLoaded = MountUGCPaths(UGCPathMap, false);
+	UnmountMissingUGC();
+
+	if (bWasAnyUGCLoaded)
 	{
-		AddUGCFromPath(UGCPath.Key);
+		ConflictIndex.LogSummary();
+		EnforceUGCResidencyBudget();
+		OnUGCPackagesChanged.Broadcast();
 	}
 
-	bool bWasAnyUGCLoaded = false;
-	IPluginManager::Get().RefreshPluginsList();
-	for (const TSharedRef<IPlugin>& Plugin : IPluginManager::Get().GetDiscoveredPlugins())
+#endif
+}
+
+void UUGCSubsystem::RefreshUGCAsync()
+{
+#if UGC_SUPPORTED_PLATFORM
+	// Do nothing if we are cooking or running a commandlet
+	if (GIsCookerLoadingPackage || IsRunningCommandlet())
+	{
+		return;
+	}
+
+	if (!UGCProvider.GetObject())
+	{
+		UE_LOG(LogModioUGC, Warning, TEXT("UGC provider is not available, skipping UGC refresh"));
+		return;
+	}
+
+	if (!IUGCProvider::Execute_IsProviderEnabled(UGCProvider.GetObject()))
+	{
+		UE_LOG(LogModioUGC, Warning, TEXT("UGC provider is not enabled, skipping UGC refresh"));
+		return;
+	}
+
+	// Providers implemented in Blueprint only have the synchronous contract
+	IUGCProvider* NativeProvider = Cast<IUGCProvider>(UGCProvider.GetObject());
+	if (!NativeProvider)
+	{
+		UE_LOG(LogModioUGC, Verbose, TEXT("UGC provider is not native, refreshing UGC synchronously"));
+		RefreshUGC();
+		return;
+	}
+
+	const uint32 RefreshSerial = ++AsyncRefreshSerial;
 	{
-		if (!Plugin->IsEnabled())
+		TArray<FUGCPackage> InternalUGCPackages = UGCPackages.Array();
+
+		for (FUGCPackage& UGCPackage : InternalUGCPackages)
 		{
-			TOptional<FGenericModID> AssociatedModID;
-			for (const TPair<FString, FGenericModID>& UGCPath : UGCPathMap.PathToModIDMap)
+			UnloadUGC(UGCPackage);
+		}
+
+		ResidencyTracker.EmptyEvicted();
+	}
+	CachedInstalledUGCPaths = FModUGCPathMap();
+
+	// Dependencies of a package may only arrive in a later batch, so every path is kept to retry those packages once
+	// the enumeration is complete
+	TSharedRef<FModUGCPathMap> EnumeratedPaths = MakeShared<FModUGCPathMap>();
+	NativeProvider->GetInstalledUGCPathsAsync(FOnUGCPathsBatchDelegate::CreateWeakLambda(
+		this, [this, RefreshSerial, EnumeratedPaths](const FModUGCPathMap& Batch, bool bIsFinalBatch) {
+			if (RefreshSerial != AsyncRefreshSerial)
+			{
+				UE_LOG(LogModioUGC, Verbose, TEXT("Ignoring %d UGC paths from a superseded refresh"),
+					   Batch.PathToModIDMap.Num());
+				return;
+			}
+
+			// Content of each batch becomes available as soon as it is mounted
+			*EnumeratedPaths += Batch;
+			CachedInstalledUGCPaths += Batch;
+			if (MountUGCPaths(Batch, true))
+			{
+				OnUGCPackagesChanged.Broadcast();
+			}
+
+			if (bIsFinalBatch)
 			{
-				if (FPaths::IsUnderDirectory(Plugin->GetBaseDir(), UGCPath.Key))
+				// Packages already mounted are skipped, so only those blocked by dependencies are considered again
+				if (!DependencyIssues.IsEmpty() && MountUGCPaths(*EnumeratedPaths, true))
 				{
-					AssociatedModID = UGCPath.Value;
-					break;
+					OnUGCPackagesChanged.Broadcast();
 				}
+				UnmountMissingUGC();
+				ConflictIndex.LogSummary();
+				EnforceUGCResidencyBudget();
+				UE_LOG(LogModioUGC, Log, TEXT("Asynchronous UGC refresh complete, %d UGC packages mounted"),
+					   UGCPackages.Num());
 			}
-			if (LoadUGC(Plugin, AssociatedModID))
+		}));
+#endif
+}
+
+bool UUGCSubsystem::MountUGCPaths(const FModUGCPathMap& UGCPathMap, bool bIncremental, bool bAssociateModIDs)
+{
+	bool bWasAnyUGCLoaded = false;
+#if UGC_SUPPORTED_PLATFORM
+	TRACE_CPUPROFILER_EVENT_SCOPE(UUGCSubsystem::MountUGCPaths);
+
+	// Mounting reads the same disk as background verification, which waits until the game is idle again
+	LastUGCActivityTime = FPlatformTime::Seconds();
+	if (BackgroundVerifier)
+	{
+		BackgroundVerifier->SetPaused(true);
+	}
+
+	// Incremental mounts only consider the plugins found under the given paths, which also skips rescanning and
+	// iterating every plugin of the project
+	TArray<FUGCLoadCandidate> LoadCandidates;
+	if (bIncremental)
+	{
+		for (const TPair<FString, FGenericModID>& UGCPath : UGCPathMap.PathToModIDMap)
+		{
+			for (const TSharedRef<IPlugin>& Plugin : AddUGCPluginsFromPath(UGCPath.Key))
 			{
-				bWasAnyUGCLoaded = true;
+				// Nested UGC paths can find the same plugin twice
+				const bool bAlreadyGathered = LoadCandidates.ContainsByPredicate(
+					[&Plugin](const FUGCLoadCandidate& Candidate) { return Candidate.Plugin == Plugin; });
+				if (!Plugin->IsEnabled() && IsUGCPlugin(Plugin) && !bAlreadyGathered)
+				{
+					const TOptional<FGenericModID> ModID =
+						bAssociateModIDs ? TOptional<FGenericModID>(UGCPath.Value) : TOptional<FGenericModID>();
+					const int32 LoadPriority = ResolveLoadPriority(Plugin, UGCPath.Key, ModID);
+					LoadCandidates.Add({Plugin, ModID, LoadPriority, FName(Plugin->GetDescriptorFileName())});
+				}
 			}
 		}
 	}
-
-	// Unmount mods whose descriptor files no longer exist
+	else
 	{
-		TSet<FName> ModsToRemove;
-		for (const FName& LoadedPluginName : LoadedUGCPlugins)
+		for (const TPair<FString, FGenericModID>& UGCPath : UGCPathMap.PathToModIDMap)
+		{
+			AddUGCFromPath(UGCPath.Key);
+		}
+		IPluginManager::Get().RefreshPluginsList();
+
+		// Gather the plugins to load first so that they can be mounted in a deterministic load order
+		for (const TSharedRef<IPlugin>& Plugin : IPluginManager::Get().GetDiscoveredPlugins())
 		{
-			const FString PluginDescriptorFile = LoadedPluginName.ToString();
-			if (!FPaths::FileExists(PluginDescriptorFile))
+			// Only UGC plugins are worth resolving a load priority for, which reads the descriptor and asks providers
+			if (!Plugin->IsEnabled() && IsUGCPlugin(Plugin))
 			{
-				ModsToRemove.Add(LoadedPluginName);
+				TOptional<FGenericModID> AssociatedModID;
+				FString AssociatedUGCPath;
+				for (const TPair<FString, FGenericModID>& UGCPath : UGCPathMap.PathToModIDMap)
+				{
+					if (FPaths::IsUnderDirectory(Plugin->GetBaseDir(), UGCPath.Key))
+					{
+						if (bAssociateModIDs)
+						{
+							AssociatedModID = UGCPath.Value;
+						}
+						AssociatedUGCPath = UGCPath.Key;
+						break;
+					}
+				}
+				const int32 LoadPriority = ResolveLoadPriority(Plugin, AssociatedUGCPath, AssociatedModID);
+				LoadCandidates.Add({Plugin, AssociatedModID, LoadPriority, FName(Plugin->GetDescriptorFileName())});
 			}
 		}
+	}
 
-		TArray<FUGCPackage> InternalUGCPackages = UGCPackages.Array();
+	LoadCandidates.Sort([](const FUGCLoadCandidate& A, const FUGCLoadCandidate& B) {
+		return FUGCPackage::LoadOrderPredicate(A.LoadPriority, A.DescriptorPath, B.LoadPriority, B.DescriptorPath);
+	});
 
-		// Unmount missing mods
-		for (FUGCPackage& UGCPackage : InternalUGCPackages)
+	// Dependencies declared in the descriptors take precedence over load priority, so packages are mounted in waves
+	// of packages that only depend on earlier waves. Candidates keep their priority order within a wave
+	FUGCDependencyGraph DependencyGraph;
+	for (const FUGCLoadCandidate& Candidate : LoadCandidates)
+	{
+		TArray<FString> Dependencies;
+		for (const FPluginReferenceDescriptor& PluginReference : Candidate.Plugin->GetDescriptor().Plugins)
 		{
-			if (ModsToRemove.Find(FName(UGCPackage.DescriptorPath)))
+			if (PluginReference.bEnabled && !PluginReference.bOptional)
 			{
-				UnmountUGCPackage(UGCPackage);
+				Dependencies.Add(PluginReference.Name);
 			}
 		}
+		DependencyGraph.AddPackage(Candidate.Plugin->GetName(), Candidate.DescriptorPath.ToString(),
+								   MoveTemp(Dependencies));
 	}
-
-	if (bWasAnyUGCLoaded)
+	DependencyGraph.Resolve([](const FString& PluginName) {
+		const TSharedPtr<IPlugin> Plugin = IPluginManager::Get().FindPlugin(PluginName);
+		return Plugin.IsValid() && Plugin->IsEnabled();
+	});
+	TArray<FString> CandidateDescriptorPaths;
+	if (bIncremental)
 	{
-		OnUGCPackagesChanged.Broadcast();
+		for (const FUGCLoadCandidate& Candidate : LoadCandidates)
+		{
+			CandidateDescriptorPaths.Add(Candidate.DescriptorPath.ToString());
+		}
 	}
+	RecordDependencyIssues(DependencyGraph.GetIssues(), bIncremental ? &CandidateDescriptorPaths : nullptr);
 
-#endif
-}
-
-bool UUGCSubsystem::LoadUGC(TSharedPtr<IPlugin> LoadedPlugin, TOptional<FGenericModID> RawModID)
-{
-#if UGC_SUPPORTED_PLATFORM
-	if (!LoadedPlugin)
+	TArray<int32> MountOrder;
+	TArray<int32> WaveStarts;
+	MountOrder.Reserve(LoadCandidates.Num());
+	for (const TArray<int32>& Wave : DependencyGraph.GetWaves())
 	{
-		UE_LOG(LogModioUGC, Warning, TEXT("Attempting to call LoadUGC on a null plugin!"));
-		return false;
+		WaveStarts.Add(MountOrder.Num());
+		MountOrder.Append(Wave);
+		Algo::Sort(MakeArrayView(MountOrder.GetData() + WaveStarts.Last(), Wave.Num()));
 	}
-	if (LoadedPlugin->GetLoadedFrom() == EPluginLoadedFrom::Project && LoadedPlugin->GetDescriptor().Category == "UGC")
+	WaveStarts.Add(MountOrder.Num());
+
+	// Read ahead the next few queued packages while the current one is being committed
+	const UModioUGCSettings* UGCSettings = GetDefault<UModioUGCSettings>();
+	const int32 PrefetchDepth = UGCSettings ? FMath::Max(UGCSettings->UGCPrefetchDepth, 0) : 0;
+	FUGCPakPrefetcher Prefetcher;
+
+	// Packages of a wave do not depend on each other, so the paks of the next wave are opened, have their indices read
+	// and, when verification is enabled, are hashed on worker threads while the current wave is committed
+	const bool bHashContent = UGCSettings && UGCSettings->bVerifyUGCContentBeforeMount;
+	auto GetWavePlugins = [&](int32 WaveIndex) {
+		TArray<TSharedRef<IPlugin>> WavePlugins;
+		for (int32 OrderIndex = WaveStarts[WaveIndex]; OrderIndex < WaveStarts[WaveIndex + 1]; ++OrderIndex)
+		{
+			WavePlugins.Add(LoadCandidates[MountOrder[OrderIndex]].Plugin);
+		}
+		return WavePlugins;
+	};
+	TFuture<void> NextWavePreparation =
+		WaveStarts.Num() > 1 ? PrepareUGCPlugins(GetWavePlugins(0), bHashContent) : TFuture<void>();
+
+	TArray<bool> MountFailed;
+	MountFailed.SetNumZeroed(LoadCandidates.Num());
+	for (int32 WaveIndex = 0; WaveIndex + 1 < WaveStarts.Num(); ++WaveIndex)
 	{
-		if (!LoadedUGCPlugins.Contains(FName(LoadedPlugin->GetDescriptorFileName())))
+		if (NextWavePreparation.IsValid())
 		{
-			UE_LOG(LogModioUGC, Verbose, TEXT("Loading UGC plugin %s from %s"), *LoadedPlugin->GetName(),
-				   *LoadedPlugin->GetDescriptorFileName());
-
-			LoadedUGCPlugins.Add(FName(LoadedPlugin->GetDescriptorFileName()));
-			IPluginManager::Get().MountNewlyCreatedPlugin(LoadedPlugin->GetName());
-
-			// We register an additional mount point so that we can dynamically unload assets correctly prior to
-			// uninstallation
-			FString RootPath;
-			FString ContentPath;
-			GetModMountPoint(LoadedPlugin, RootPath, ContentPath);
-
-			FPackageName::RegisterMountPoint(RootPath, ContentPath);
-			FUGCPackage ModPackage {LoadedPlugin.ToSharedRef(), RawModID};
-
-			// If we failed during the package object creation, unmount this piece of UGC straight away
-			if (ModPackage.MountState != EUGCPackageMountState::EUPMS_Mounted)
+			NextWavePreparation.Wait();
+		}
+		NextWavePreparation = WaveIndex + 2 < WaveStarts.Num()
+								  ? PrepareUGCPlugins(GetWavePlugins(WaveIndex + 1), bHashContent)
+								  : TFuture<void>();
+
+		// Mounting pak files is not thread-safe, so the paks of the wave are mounted one package at a time. The asset
+		// registries are then loaded from the mounted paks in parallel, before the packages are committed in order
+		TArray<TPair<int32, FUGCPackage>> WavePackages;
+		for (int32 OrderIndex = WaveStarts[WaveIndex]; OrderIndex < WaveStarts[WaveIndex + 1]; ++OrderIndex)
+		{
+			const int32 LastPrefetchIndex = FMath::Min(OrderIndex + PrefetchDepth, MountOrder.Num() - 1);
+			for (int32 PrefetchIndex = OrderIndex + 1; PrefetchIndex <= LastPrefetchIndex; ++PrefetchIndex)
 			{
-				UnloadUGC(ModPackage);
-				return false;
+				Prefetcher.Prefetch(LoadCandidates[MountOrder[PrefetchIndex]].Plugin);
 			}
 
-			UGCPackages.Add(ModPackage);
+			const int32 CandidateIndex = MountOrder[OrderIndex];
+			const FUGCLoadCandidate& Candidate = LoadCandidates[CandidateIndex];
+			const TArray<int32>& Dependencies = DependencyGraph.GetDependencies(CandidateIndex);
+			if (Dependencies.ContainsByPredicate([&MountFailed](int32 Dependency) { return MountFailed[Dependency]; }))
+			{
+				UE_LOG(LogModioUGC, Error, TEXT("Skipping UGC plugin %s because a dependency failed to mount"),
+					   *Candidate.Plugin->GetName());
+				MountFailed[CandidateIndex] = true;
+				continue;
+			}
 
-			if (ModPackage.PackageMetadata.IsValid())
+			if (TOptional<FUGCPackage> ModPackage =
+					BeginLoadUGC(Candidate.Plugin, Candidate.ModID, Candidate.LoadPriority))
 			{
-				for (FPrimaryAssetTypeInfo PrimaryTypeInfo : ModPackage.PackageMetadata->PrimaryAssetTypesToScan)
-				{
-					RegisteredPackagesToPrimaryAssetTypesMap.Add(ModPackage, PrimaryTypeInfo.PrimaryAssetType);
-				}
+				WavePackages.Emplace(CandidateIndex, MoveTemp(*ModPackage));
+			}
+			else if (!LoadedUGCPlugins.Contains(Candidate.DescriptorPath))
+			{
+				MountFailed[CandidateIndex] = true;
 			}
-			return true;
 		}
-		else
+
+		ParallelFor(WavePackages.Num(),
+					[&WavePackages](int32 PackageIndex) { WavePackages[PackageIndex].Value.PreloadAssetRegistry(); });
+
+		for (TPair<int32, FUGCPackage>& WavePackage : WavePackages)
 		{
-			UE_LOG(LogModioUGC, VeryVerbose, TEXT("UGC plugin located at %s already loaded, skipping"),
-				   *LoadedPlugin->GetDescriptorFileName());
+			if (FinishLoadUGC(WavePackage.Value))
+			{
+				bWasAnyUGCLoaded = true;
+			}
+			else if (!LoadedUGCPlugins.Contains(LoadCandidates[WavePackage.Key].DescriptorPath))
+			{
+				MountFailed[WavePackage.Key] = true;
+			}
 		}
 	}
 #endif
-	return false;
+	return bWasAnyUGCLoaded;
 }
 
-bool UUGCSubsystem::UnloadUGC(FUGCPackage& Package)
+TFuture<void> UUGCSubsystem::PrepareUGCPlugins(TArray<TSharedRef<IPlugin>> Plugins, bool bHashContent)
 {
-#if UGC_SUPPORTED_PLATFORM
-	UE_LOG(LogModioUGC, Verbose, TEXT("Unloading UGC plugin %s"), *Package.FriendlyName);
-	bool _ = Package.UnloadAssets();
+	return Async(EAsyncExecution::ThreadPool, [Plugins = MoveTemp(Plugins), bHashContent]() {
+		TRACE_CPUPROFILER_EVENT_SCOPE(UUGCSubsystem::PrepareUGCPlugins);
+		TArray<FString> PakPaths;
+		for (const TSharedRef<IPlugin>& Plugin : Plugins)
+		{
+			FPakFileSearchVisitor PakVisitor(PakPaths);
+			IPlatformFile::GetPlatformPhysical().IterateDirectoryRecursively(*Plugin->GetContentDir(), PakVisitor);
+		}
 
-	UnmountUGCPackage(Package, true);
+		// Invalid paks are reported when they fail to mount
+		ParallelFor(PakPaths.Num(), [&PakPaths](int32 PakIndex) {
+			FPakInfo PakInfo;
+			PreloadPakIndex(PakPaths[PakIndex], PakInfo);
+		});
+		if (!bHashContent)
+		{
+			return;
+		}
 
-	RegisteredPackagesToPrimaryAssetTypesMap.Remove(Package);
+		// Files without a stored digest are not verified at mount time, so hashing them would be wasted work
+		TArray<FString> ContentFiles;
+		for (const FString& PakPath : PakPaths)
+		{
+			for (const FString& ContentFile : FUGCContentVerifier::GetContentFilesForPak(PakPath))
+			{
+				uint64 StoredDigest = 0;
+				if (FUGCContentVerifier::LoadStoredDigest(ContentFile, StoredDigest))
+				{
+					ContentFiles.Add(ContentFile);
+				}
+			}
+		}
 
-	return true;
-#else
-	return false;
-#endif
+		// Only the digests are cached here, mismatches are reported when the package is verified at mount time
+		ParallelFor(ContentFiles.Num(), [&ContentFiles](int32 FileIndex) {
+			uint64 Digest = 0;
+			FUGCContentVerifier::Get().GetFileDigest(ContentFiles[FileIndex], Digest);
+		});
+	});
 }
 
-bool UUGCSubsystem::UnloadUGCByModID(FGenericModID ModID)
+void UUGCSubsystem::RecordDependencyIssues(const TArray<FUGCPackageDependencyIssue>& Issues,
+										   const TArray<FString>* ReplacedDescriptorPaths)
 {
-#if UGC_SUPPORTED_PLATFORM
-	FUGCPackage Package;
-	if (GetUGCPackageByModID(ModID, Package))
+	if (ReplacedDescriptorPaths)
 	{
-		return UnloadUGC(Package);
+		// Incremental mounts only replace the issues of the packages they considered
+		DependencyIssues.RemoveAll([ReplacedDescriptorPaths](const FUGCPackageDependencyIssue& Issue) {
+			return ReplacedDescriptorPaths->Contains(Issue.DescriptorPath);
+		});
 	}
 	else
 	{
-		UE_LOG(LogModioUGC, Warning, TEXT("Failed to unload UGC package by ModID since it was not found"));
+		DependencyIssues.Reset();
+	}
 
-		// Still return true, as the package is already in unloaded state
-		return true;
+	for (const FUGCPackageDependencyIssue& Issue : Issues)
+	{
+		const FString Dependencies = FString::Join(Issue.Dependencies, TEXT(", "));
+		switch (Issue.IssueType)
+		{
+			case EUGCPackageDependencyIssueType::MissingDependency:
+				UE_LOG(LogModioUGC, Error, TEXT("UGC plugin %s will not be mounted, missing dependencies: %s"),
+					   *Issue.PluginName, *Dependencies);
+				break;
+			case EUGCPackageDependencyIssueType::DependencyCycle:
+				UE_LOG(LogModioUGC, Error, TEXT("UGC plugin %s will not be mounted, dependency cycle: %s"),
+					   *Issue.PluginName, *Dependencies);
+				break;
+			default:
+				UE_LOG(LogModioUGC, Error, TEXT("UGC plugin %s will not be mounted, blocked by dependencies: %s"),
+					   *Issue.PluginName, *Dependencies);
+				break;
+		}
 	}
-#endif
-	return false;
+	DependencyIssues.Append(Issues);
 }
 
-bool UUGCSubsystem::IsUGCCompatible(const FString& UPluginFilePath)
+TArray<FUGCPackageDependencyIssue> UUGCSubsystem::GetUGCDependencyIssues() const
+{
+	return DependencyIssues;
+}
+
+TArray<FString> UUGCSubsystem::GetDamagedUGCPaths() const
+{
+	return DamagedUGCPaths;
+}
+
+bool UUGCSubsystem::TickBackgroundVerification(float DeltaTime)
 {
-#if UGC_SUPPORTED_PLATFORM
 	const UModioUGCSettings* UGCSettings = GetDefault<UModioUGCSettings>();
-	if (!(UGCSettings && UGCSettings->bPerformUGCCheckVersion))
+	if (!UGCSettings || !UGCSettings->bEnableBackgroundUGCVerification)
 	{
-		// If we don't want to check the version, we can skip the rest of the checks
 		return true;
 	}
 
-	FString FileName = FPaths::GetCleanFilename(UPluginFilePath);
-	UE_LOG(LogModioUGC, Log, TEXT("Validating uplugin '%s'"), *FileName);
+	const double Now = FPlatformTime::Seconds();
+	if (IsAsyncLoading())
+	{
+		LastUGCActivityTime = Now;
+	}
+	const bool bIdle = Now - LastUGCActivityTime >= UGCSettings->BackgroundUGCVerificationIdleDelay;
 
-	// Read the uplugin file
-	FString UPluginContent;
-	if (!FFileHelper::LoadFileToString(UPluginContent, *UPluginFilePath))
+	if (BackgroundVerifier && BackgroundVerifier->IsPassRunning())
 	{
-		UE_LOG(LogModioUGC, Error, TEXT("Failed to read uplugin file."));
-		return false;
+		BackgroundVerifier->SetPaused(!bIdle);
+		return true;
 	}
 
-	// Parse JSON
-	TSharedPtr<FJsonObject> JsonObject;
-	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(UPluginContent);
-	if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
+	if (!bIdle || !UGCProvider.GetObject() ||
+		(bHasCompletedBackgroundVerification &&
+		 Now - LastBackgroundVerificationTime < UGCSettings->BackgroundUGCVerificationInterval))
 	{
-		UE_LOG(LogModioUGC, Error, TEXT("Failed to parse uplugin JSON"));
-		return false;
+		return true;
 	}
 
-	if (UGCSettings->ShouldCheckEngineVersion())
+	TArray<FUGCBackgroundVerifier::FTarget> Targets = GatherBackgroundVerificationTargets();
+	if (Targets.IsEmpty())
 	{
-		// Check if engine version field exists
-		FString UGCEngineVersionString;
-		FEngineVersion UGCEngineVersion;
-		if (!JsonObject->TryGetStringField(TEXT("EngineVersion"), UGCEngineVersionString))
+		return true;
+	}
+
+	if (!BackgroundVerifier)
+	{
+		const int64 MaxBytesPerSecond = static_cast<int64>(UGCSettings->BackgroundUGCVerificationReadRateMB) << 20;
+		BackgroundVerifier = MakeShared<FUGCBackgroundVerifier, ESPMode::ThreadSafe>(MaxBytesPerSecond);
+	}
+	BackgroundVerifier->SetPaused(false);
+	BackgroundVerifier->StartPass(
+		MoveTemp(Targets), [WeakThis = TWeakObjectPtr<UUGCSubsystem>(this)](
+							   TArray<FUGCBackgroundVerifier::FDamagedUGC> DamagedUGC) {
+			if (UUGCSubsystem* This = WeakThis.Get())
+			{
+				This->OnBackgroundVerificationPassComplete(DamagedUGC);
+			}
+		});
+	return true;
+}
+
+TArray<FUGCBackgroundVerifier::FTarget> UUGCSubsystem::GatherBackgroundVerificationTargets() const
+{
+	TArray<FUGCBackgroundVerifier::FTarget> Targets;
+	for (const TPair<FString, FGenericModID>& UGCPath : CachedInstalledUGCPaths.PathToModIDMap)
+	{
+		FUGCBackgroundVerifier::FTarget& Target = Targets.AddDefaulted_GetRef();
+		Target.UGCPath = UGCPath.Key;
+		Target.ModID = UGCPath.Value;
+	}
+
+	// Packages added with AddUGCFromPath are mounted without being installed by the provider. The package path is the
+	// mount root of the package, so the directory of its plugin is verified instead
+	for (const FUGCPackage& Package : UGCPackages)
+	{
+		if (!Package.GetAssociatedPlugin())
 		{
-			UE_LOG(LogModioUGC, Warning, TEXT("uplugin missing engine version."));
-			return false;
+			continue;
 		}
-		if (!FEngineVersion::Parse(UGCEngineVersionString, UGCEngineVersion))
+		const FString PluginDir = Package.GetAssociatedPlugin()->GetBaseDir();
+		const bool bUnderInstalledPath = Targets.ContainsByPredicate(
+			[&PluginDir](const FUGCBackgroundVerifier::FTarget& Target) {
+				return FPaths::IsUnderDirectory(PluginDir, Target.UGCPath);
+			});
+		if (!bUnderInstalledPath)
 		{
-			UE_LOG(LogModioUGC, Warning, TEXT("Failed to parse engine version from value: '%s'"), *UGCEngineVersionString);
-			return false;
+			FUGCBackgroundVerifier::FTarget& Target = Targets.AddDefaulted_GetRef();
+			Target.UGCPath = PluginDir;
+			Target.ModID = Package.GetModID().Get(FGenericModID());
+		}
+	}
+	return Targets;
+}
+
+void UUGCSubsystem::OnBackgroundVerificationPassComplete(
+	const TArray<FUGCBackgroundVerifier::FDamagedUGC>& DamagedUGC)
+{
+	LastBackgroundVerificationTime = FPlatformTime::Seconds();
+	bHasCompletedBackgroundVerification = true;
+
+	DamagedUGCPaths.Reset();
+	for (const FUGCBackgroundVerifier::FDamagedUGC& Damaged : DamagedUGC)
+	{
+		UE_LOG(LogModioUGC, Warning, TEXT("Installed UGC %s is damaged (%d damaged files), reporting it for repair"),
+			   *Damaged.UGCPath, Damaged.DamagedFiles.Num());
+		DamagedUGCPaths.Add(Damaged.UGCPath);
+		if (UGCProvider.GetObject())
+		{
+			IUGCProvider::Execute_ReportDamagedUGC(UGCProvider.GetObject(), Damaged.UGCPath, Damaged.ModID,
+												   Damaged.DamagedFiles);
+		}
+	}
+}
+
+void UUGCSubsystem::UnmountMissingUGC()
+{
+	// Unmount mods whose descriptor files no longer exist
+	TSet<FName> ModsToRemove;
+	for (const FName& LoadedPluginName : LoadedUGCPlugins)
+	{
+		const FString PluginDescriptorFile = LoadedPluginName.ToString();
+		if (!FPaths::FileExists(PluginDescriptorFile))
+		{
+			ModsToRemove.Add(LoadedPluginName);
+		}
+	}
+
+	TArray<FUGCPackage> InternalUGCPackages = UGCPackages.Array();
+
+	// Unmount missing mods
+	for (FUGCPackage& UGCPackage : InternalUGCPackages)
+	{
+		// Nothing is retained for warm remounting, as a package without a descriptor cannot be mounted again
+		if (ModsToRemove.Find(UGCPackage.GetInfo().DescriptorPath))
+		{
+			UnmountAndUnregisterUGCPackage(UGCPackage, false);
+		}
+	}
+}
+
+int32 UUGCSubsystem::ResolveLoadPriority(const TSharedRef<IPlugin>& Plugin, const FString& UGCPath,
+										 TOptional<FGenericModID> RawModID)
+{
+	int32 Priority = 0;
+	if (RawModID.IsSet() && NativeQueryModLoadPriority(RawModID.GetValue(), Priority))
+	{
+		return Priority;
+	}
+
+	if (UGCProvider.GetObject() &&
+		IUGCProvider::Execute_GetUGCLoadPriority(UGCProvider.GetObject(), UGCPath, RawModID.Get(FGenericModID()),
+												  Priority))
+	{
+		return Priority;
+	}
+
+	if (GetDescriptorLoadPriority(Plugin->GetDescriptorFileName(), Priority))
+	{
+		return Priority;
+	}
+
+	return 0;
+}
+
+bool UUGCSubsystem::LoadUGC(TSharedPtr<IPlugin> LoadedPlugin, TOptional<FGenericModID> RawModID, int32 LoadPriority)
+{
+	TOptional<FUGCPackage> ModPackage = BeginLoadUGC(LoadedPlugin, RawModID, LoadPriority);
+	return ModPackage.IsSet() && FinishLoadUGC(*ModPackage);
+}
+
+TOptional<FUGCPackage> UUGCSubsystem::BeginLoadUGC(TSharedPtr<IPlugin> LoadedPlugin,
+													TOptional<FGenericModID> RawModID, int32 LoadPriority)
+{
+	TOptional<FUGCPackage> ModPackage;
+#if UGC_SUPPORTED_PLATFORM
+	if (!LoadedPlugin)
+	{
+		UE_LOG(LogModioUGC, Warning, TEXT("Attempting to call LoadUGC on a null plugin!"));
+		return ModPackage;
+	}
+	if (IsUGCPlugin(LoadedPlugin.ToSharedRef()))
+	{
+		if (!LoadedUGCPlugins.Contains(FName(LoadedPlugin->GetDescriptorFileName())))
+		{
+			UE_LOG(LogModioUGC, Verbose, TEXT("Loading UGC plugin %s from %s"), *LoadedPlugin->GetName(),
+				   *LoadedPlugin->GetDescriptorFileName());
+
+			LoadedUGCPlugins.Add(FName(LoadedPlugin->GetDescriptorFileName()));
+			IPluginManager::Get().MountNewlyCreatedPlugin(LoadedPlugin->GetName());
+
+			// We register an additional mount point so that we can dynamically unload assets correctly prior to
+			// uninstallation
+			FString RootPath;
+			FString ContentPath;
+			GetModMountPoint(LoadedPlugin, RootPath, ContentPath);
+
+			FPackageName::RegisterMountPoint(RootPath, ContentPath);
+			ModPackage.Emplace(LoadedPlugin.ToSharedRef(), RawModID, LoadPriority, true);
+		}
+		else
+		{
+			UE_LOG(LogModioUGC, VeryVerbose, TEXT("UGC plugin located at %s already loaded, skipping"),
+				   *LoadedPlugin->GetDescriptorFileName());
+		}
+	}
+#endif
+	return ModPackage;
+}
+
+bool UUGCSubsystem::FinishLoadUGC(FUGCPackage& ModPackage)
+{
+#if UGC_SUPPORTED_PLATFORM
+	// If we failed during the package object creation, unmount this piece of UGC straight away
+	if (!ModPackage.FinishMount())
+	{
+		UnloadUGC(ModPackage);
+		return false;
+	}
+
+	UGCPackages.Add(ModPackage);
+	AddUGCPackageToAttributionIndex(ModPackage);
+	ResidencyTracker.AddResident(ModPackage.GetInfo().DescriptorPath);
+	if (const int32 NumConflicts = ConflictIndex.AddPackage(ModPackage))
+	{
+		UE_LOG(LogModioUGC, Warning, TEXT("UGC plugin %s has %d path conflicts, see GetConflictsForUGCPackage"),
+			   *ModPackage.GetFriendlyName(), NumConflicts);
+	}
+
+	if (UUGC_Metadata* PackageMetadata = ModPackage.GetState().PackageMetadata.Get())
+	{
+		for (FPrimaryAssetTypeInfo PrimaryTypeInfo : PackageMetadata->PrimaryAssetTypesToScan)
+		{
+			RegisteredPackagesToPrimaryAssetTypesMap.Add(ModPackage, PrimaryTypeInfo.PrimaryAssetType);
+		}
+	}
+	return true;
+#else
+	return false;
+#endif
+}
+
+bool UUGCSubsystem::UnloadUGC(FUGCPackage& Package)
+{
+#if UGC_SUPPORTED_PLATFORM
+	UE_LOG(LogModioUGC, Verbose, TEXT("Unloading UGC plugin %s"), *Package.GetFriendlyName());
+	// Unloading assets releases the loaded registry, so it has to be retained first
+	RetainForWarmRemount(Package);
+	const bool bVerifyUnload = FUGCLeakDetector::Get().ShouldVerify();
+	const TArray<FName> PackageNames = bVerifyUnload ? GetPackageNamesFromUGCPackage(Package) : TArray<FName>();
+	bool _ = Package.UnloadAssets();
+
+	UnmountAndUnregisterUGCPackage(Package, true);
+
+	RegisteredPackagesToPrimaryAssetTypesMap.Remove(Package);
+
+	// UnloadAssets collected garbage, so anything left of the package is kept alive by a reference
+	if (bVerifyUnload)
+	{
+		FUGCLeakDetector::Get().Verify(Package.GetFriendlyName(), Package.GetInfo().PackagePath, PackageNames);
+	}
+
+	return true;
+#else
+	return false;
+#endif
+}
+
+bool UUGCSubsystem::UnloadUGCByModID(FGenericModID ModID)
+{
+#if UGC_SUPPORTED_PLATFORM
+	if (!UnloadUGCByModID_Internal(ModID))
+	{
+		UE_LOG(LogModioUGC, Warning, TEXT("Failed to unload UGC package by ModID since it was not found"));
+	}
+
+	// Still return true if nothing was found, as the package is already in unloaded state
+	return true;
+#endif
+	return false;
+}
+
+bool UUGCSubsystem::UnloadUGCByModID_Internal(FGenericModID ModID)
+{
+	bool bWasAnyUGCUnloaded = false;
+#if UGC_SUPPORTED_PLATFORM
+	// UnloadUGC modifies the UGCPackages set, so we need to make a copy to iterate over
+	TArray<FUGCPackage> UGCPackagesCopy = UGCPackages.Array();
+	for (FUGCPackage& CurrentPackage : UGCPackagesCopy)
+	{
+		if (CurrentPackage.GetModID().IsSet() && CurrentPackage.GetModID().GetValue() == ModID)
+		{
+			bWasAnyUGCUnloaded |= UnloadUGC(CurrentPackage);
+		}
+	}
+#endif
+	return bWasAnyUGCUnloaded;
+}
+
+bool UUGCSubsystem::IsUGCCompatible(const FString& UPluginFilePath)
+{
+#if UGC_SUPPORTED_PLATFORM
+	const UModioUGCSettings* UGCSettings = GetDefault<UModioUGCSettings>();
+	if (!(UGCSettings && UGCSettings->bPerformUGCCheckVersion))
+	{
+		// If we don't want to check the version, we can skip the rest of the checks
+		return true;
+	}
+
+	FString FileName = FPaths::GetCleanFilename(UPluginFilePath);
+	UE_LOG(LogModioUGC, Log, TEXT("Validating uplugin '%s'"), *FileName);
+
+	// Read the uplugin file
+	FString UPluginContent;
+	if (!FFileHelper::LoadFileToString(UPluginContent, *UPluginFilePath))
+	{
+		UE_LOG(LogModioUGC, Error, TEXT("Failed to read uplugin file."));
+		return false;
+	}
+
+	// Parse JSON
+	TSharedPtr<FJsonObject> JsonObject;
+	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(UPluginContent);
+	if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
+	{
+		UE_LOG(LogModioUGC, Error, TEXT("Failed to parse uplugin JSON"));
+		return false;
+	}
+
+	if (UGCSettings->ShouldCheckEngineVersion())
+	{
+		// Check if engine version field exists
+		FString UGCEngineVersionString;
+		FEngineVersion UGCEngineVersion;
+		if (!JsonObject->TryGetStringField(TEXT("EngineVersion"), UGCEngineVersionString))
+		{
+			UE_LOG(LogModioUGC, Warning, TEXT("uplugin missing engine version."));
+			return false;
+		}
+		if (!FEngineVersion::Parse(UGCEngineVersionString, UGCEngineVersion))
+		{
+			UE_LOG(LogModioUGC, Warning, TEXT("Failed to parse engine version from value: '%s'"), *UGCEngineVersionString);
+			return false;
 		}
 
 		if (!UGCSettings->IsEngineVersionCompatible(UGCEngineVersion))
@@ -445,6 +1054,12 @@ bool UUGCSubsystem::IsUGCCompatible(const FString& UPluginFilePath)
 
 void UUGCSubsystem::AddUGCFromPath(const FString& Path)
 {
+	AddUGCPluginsFromPath(Path);
+}
+
+TArray<TSharedRef<IPlugin>> UUGCSubsystem::AddUGCPluginsFromPath(const FString& Path)
+{
+	TArray<TSharedRef<IPlugin>> Plugins;
 #if UGC_SUPPORTED_PLATFORM
 	UE_LOG(LogModioUGC, Log, TEXT("Searching for UGC plugins at '%s'"), *Path);
 
@@ -475,7 +1090,8 @@ void UUGCSubsystem::AddUGCFromPath(const FString& Path)
 
 			if (PluginDirectory == FoundPluginDirectory)
 			{
-				// Same plugin, skip
+				// Same plugin, already in the plugin list
+				Plugins.Add(FoundPlugin.ToSharedRef());
 				continue;
 			}
 
@@ -494,6 +1110,10 @@ void UUGCSubsystem::AddUGCFromPath(const FString& Path)
 		{
 			bAddSearchPath = true;
 			UE_LOG(LogModioUGC, Log, TEXT("Added UGC plugin '%s' from '%s'"), *PluginName, *PluginFilePath);
+			if (TSharedPtr<IPlugin> AddedPlugin = IPluginManager::Get().FindPlugin(PluginName))
+			{
+				Plugins.Add(AddedPlugin.ToSharedRef());
+			}
 		}
 	}
 	if (bAddSearchPath)
@@ -501,6 +1121,7 @@ void UUGCSubsystem::AddUGCFromPath(const FString& Path)
 		IPluginManager::Get().AddPluginSearchPath(Path, false);
 	}
 #endif
+	return Plugins;
 }
 
 bool UUGCSubsystem::NativeQueryIsModEnabled(FGenericModID ModID)
@@ -562,13 +1183,37 @@ bool UUGCSubsystem::NativeRequestModEnabledStateChange(FGenericModID ID, bool bN
 #endif
 }
 
+int32 UUGCSubsystem::RequestModEnabledStateChanges(const TMap<FGenericModID, bool>& NewStates)
+{
+#if UGC_SUPPORTED_PLATFORM
+	const UModioUGCSettings* UGCSettings = GetDefault<UModioUGCSettings>();
+	if (!UGCSettings || !UGCSettings->bEnableModEnableDisableFeature || !ModEnabledStateProvider)
+	{
+		return 0;
+	}
+
+	const TArray<FModEnabledStateChange> Changes =
+		IModEnabledStateProvider::Execute_RequestModEnabledStateChanges(ModEnabledStateProvider.GetObject(), NewStates);
+
+	// A bulk change is a single transaction, so only the batched event is broadcast
+	if (!Changes.IsEmpty())
+	{
+		OnModEnabledStatesChanged.Broadcast(Changes);
+	}
+	return Changes.Num();
+#else
+	return 0;
+#endif
+}
+
 bool UUGCSubsystem::GetUGCPackageByModID(FGenericModID ModID, FUGCPackage& UGCPackage) const
 {
 #if UGC_SUPPORTED_PLATFORM
 	for (const FUGCPackage& CurrentPackage : UGCPackages)
 	{
-		if (CurrentPackage.ModID.IsSet() && CurrentPackage.ModID.GetValue() == ModID)
+		if (CurrentPackage.GetModID().IsSet() && CurrentPackage.GetModID().GetValue() == ModID)
 		{
+			ResidencyTracker.Touch(CurrentPackage.GetInfo().DescriptorPath);
 			UGCPackage = CurrentPackage;
 			return true;
 		}
@@ -577,6 +1222,28 @@ bool UUGCSubsystem::GetUGCPackageByModID(FGenericModID ModID, FUGCPackage& UGCPa
 	return false;
 }
 
+bool UUGCSubsystem::NativeQueryModLoadPriority(FGenericModID ModID, int32& OutPriority)
+{
+#if UGC_SUPPORTED_PLATFORM
+	if (ModEnabledStateProvider)
+	{
+		return IModEnabledStateProvider::Execute_QueryModLoadPriority(ModEnabledStateProvider.GetObject(), ModID,
+																	 OutPriority);
+	}
+#endif
+	return false;
+}
+
+TArray<FUGCPackage> UUGCSubsystem::GetUGCPackagesInLoadOrder() const
+{
+	TArray<FUGCPackage> OrderedPackages = UGCPackages.Array();
+	OrderedPackages.RemoveAll([](const FUGCPackage& Package) {
+		return Package.GetMountState() == EUGCPackageMountState::EUPMS_Hidden;
+	});
+	OrderedPackages.Sort(&FUGCPackage::LoadOrderPredicate);
+	return OrderedPackages;
+}
+
 void UUGCSubsystem::EnumerateAllUGCPackages(const UGCPackageEnumeratorFn& Enumerator) const
 {
 #if UGC_SUPPORTED_PLATFORM
@@ -587,12 +1254,17 @@ void UUGCSubsystem::EnumerateAllUGCPackages(const UGCPackageEnumeratorFn& Enumer
 		{
 			std::ignore = Algo::AllOf(UGCPackages,
 						[Enumerator, ModEnabledStateProvider = ModEnabledStateProvider](const FUGCPackage& Package) {
+							// Hidden packages stay mounted but are not exposed
+							if (Package.GetMountState() == EUGCPackageMountState::EUPMS_Hidden)
+							{
+								return true;
+							}
 							// Only packages with an associated mod ID are supported by enable/disable
-							if (Package.ModID.IsSet())
+							if (Package.GetModID().IsSet())
 							{
 								// Only enumerate enabled packages
 								if (IModEnabledStateProvider::Execute_QueryIsModEnabled(
-										ModEnabledStateProvider.GetObject(), Package.ModID.GetValue()))
+										ModEnabledStateProvider.GetObject(), Package.GetModID().GetValue()))
 								{
 									return Enumerator(Package);
 								}
@@ -606,7 +1278,9 @@ void UUGCSubsystem::EnumerateAllUGCPackages(const UGCPackageEnumeratorFn& Enumer
 						});
 			return;
 		}
-		std::ignore = Algo::AllOf(UGCPackages, Enumerator);
+		std::ignore = Algo::AllOf(UGCPackages, [&Enumerator](const FUGCPackage& Package) {
+			return Package.GetMountState() == EUGCPackageMountState::EUPMS_Hidden || Enumerator(Package);
+		});
 	}
 #endif
 }
@@ -627,87 +1301,735 @@ void UUGCSubsystem::K2_EnumerateAllUGCPackages(const FUGCPackageEnumeratorDelega
 
 void UUGCSubsystem::UnloadAllUGCPackages()
 {
-	TArray<FUGCPackage> UGCPackagesToUnmount;
-	EnumerateAllUGCPackages([&UGCPackagesToUnmount](const FUGCPackage& Package) {
-		UGCPackagesToUnmount.Add(Package);
-		return true;
-	});
+	// Not using EnumerateAllUGCPackages, as hidden packages are still mounted and have to be unloaded as well
+	TArray<FUGCPackage> UGCPackagesToUnmount = UGCPackages.Array();
 	for (FUGCPackage& Package : UGCPackagesToUnmount)
 	{
 		UnloadUGC(Package);
 	}
 }
 
-void UUGCSubsystem::UnmountUGCPackageByModID(FGenericModID ModID, bool bRemoveUGCPackage)
+bool UUGCSubsystem::SetUGCPackageHidden(FUGCPackage& Package, bool bHidden)
 {
 #if UGC_SUPPORTED_PLATFORM
-	// UnmountUGCPackage modifies the UGCPackages array, so we need to make a copy to iterate over
-	TArray<FUGCPackage> UGCPackagesCopy = UGCPackages.Array();
-
-	// Not using EnumerateAllUGCPackages because we want mutable refs
-	for (FUGCPackage& CurrentPackage : UGCPackagesCopy)
+	const EUGCPackageMountState TargetState =
+		bHidden ? EUGCPackageMountState::EUPMS_Hidden : EUGCPackageMountState::EUPMS_Mounted;
+	if (Package.GetMountState() == TargetState)
 	{
-		if (CurrentPackage.ModID.IsSet() && CurrentPackage.ModID.GetValue() == ModID)
-		{
-			UnmountUGCPackage(CurrentPackage, bRemoveUGCPackage);
-		}
+		return true;
+	}
+	if (Package.GetMountState() == EUGCPackageMountState::EUPMS_Unmounted || !UGCPackages.Contains(Package))
+	{
+		UE_LOG(LogModioUGC, Warning, TEXT("Cannot %s UGC package %s as it is not mounted"),
+			   bHidden ? TEXT("hide") : TEXT("show"), *Package.GetFriendlyName());
+		return false;
 	}
-#endif
-}
-
-void UUGCSubsystem::UnmountUGCPackage(FUGCPackage& Package, bool bRemoveUGCPackage)
-{
-#if UGC_SUPPORTED_PLATFORM
-	UnmountUGCPackage_Internal(Package);
 
-	if (bRemoveUGCPackage)
+	const double StartTime = FPlatformTime::Seconds();
+	if (!(bHidden ? Package.Hide() : Package.Show()))
 	{
-		UGCPackages.Remove(Package);
-		LoadedUGCPlugins.Remove(FName(Package.AssociatedPlugin->GetDescriptorFileName()));
+		UE_LOG(LogModioUGC, Warning, TEXT("Failed to %s UGC package %s"), bHidden ? TEXT("hide") : TEXT("show"),
+			   *Package.GetFriendlyName());
+		return false;
 	}
 
+	UE_LOG(LogModioUGC, Verbose, TEXT("%s UGC package %s in %.2f ms (%lld bytes resident)"),
+		   bHidden ? TEXT("Hid") : TEXT("Showed"), *Package.GetFriendlyName(),
+		   (FPlatformTime::Seconds() - StartTime) * 1000.0, GetUGCPackageResidentSize(Package));
 	OnUGCPackagesChanged.Broadcast();
+	return true;
+#else
+	return false;
 #endif
 }
 
-void UUGCSubsystem::UnmountUGCPackage_Internal(FUGCPackage& Package)
+bool UUGCSubsystem::SetUGCPackageHiddenByModID(FGenericModID ModID, bool bHidden)
 {
-#if UGC_SUPPORTED_PLATFORM
-	FScopedPlatformPakFileOverride PlatformPakFile {};
-
-	UE_LOG(LogModioUGC, Verbose, TEXT("Unmounting UGC Package %s"), *Package.FriendlyName);
-
-	for (const FString& PakFile : Package.MountedPakFilePaths)
+	FUGCPackage Package;
+	if (!GetUGCPackageByModID(ModID, Package))
 	{
-		UE_LOG(LogModioUGC, VeryVerbose, TEXT("Unmounting UGC pak file %s"), *PakFile);
-		PlatformPakFile->Unmount(*PakFile);
+		UE_LOG(LogModioUGC, Warning, TEXT("Failed to hide or show UGC package by ModID since it was not found"));
+		return false;
 	}
+	return SetUGCPackageHidden(Package, bHidden);
+}
 
-	Package.MountState = EUGCPackageMountState::EUPMS_Unmounted;
-
-	if (!Package.AssociatedPlugin)
+int64 UUGCSubsystem::GetUGCPackageResidentSize(const FUGCPackage& UGCPackage) const
+{
+	const FUGCPackageState& State = UGCPackage.GetState();
+	SIZE_T ResidentSize = 0;
+	if (State.LoadedAssetRegistryState.IsValid())
 	{
-		UE_LOG(LogModioUGC, Warning, TEXT("Associated plugin for UGC package %s is null!"), *Package.FriendlyName);
-		return;
+		ResidentSize += State.LoadedAssetRegistryState->GetAllocatedSize();
 	}
+	if (State.FileIndex.IsValid())
+	{
+		ResidentSize += State.FileIndex->GetAllocatedSize();
+	}
+	if (const UUGC_Metadata* PackageMetadata = State.PackageMetadata.Get())
+	{
+		ResidentSize += PackageMetadata->GetResourceSizeBytes(EResourceSizeMode::EstimatedTotal);
+	}
+	return static_cast<int64>(ResidentSize);
+}
+
+int64 UUGCSubsystem::GetHiddenUGCPackagesResidentSize() const
+{
+	int64 ResidentSize = 0;
+	for (const FUGCPackage& Package : UGCPackages)
+	{
+		if (Package.GetMountState() == EUGCPackageMountState::EUPMS_Hidden)
+		{
+			ResidentSize += GetUGCPackageResidentSize(Package);
+		}
+	}
+	return ResidentSize;
+}
+
+void UUGCSubsystem::PinUGCPackage(const FUGCPackage& UGCPackage)
+{
+	ResidencyTracker.Pin(UGCPackage.GetInfo().DescriptorPath);
+}
+
+void UUGCSubsystem::UnpinUGCPackage(const FUGCPackage& UGCPackage)
+{
+	if (!ResidencyTracker.Unpin(UGCPackage.GetInfo().DescriptorPath))
+	{
+		UE_LOG(LogModioUGC, Warning, TEXT("UGC package %s was not pinned"), *UGCPackage.GetFriendlyName());
+	}
+}
+
+bool UUGCSubsystem::PinUGCPackageByModID(FGenericModID ModID)
+{
+	FUGCPackage Package;
+	if (!EnsureUGCPackageResidentByModID(ModID, Package))
+	{
+		return false;
+	}
+	PinUGCPackage(Package);
+	return true;
+}
+
+void UUGCSubsystem::UnpinUGCPackageByModID(FGenericModID ModID)
+{
+	FUGCPackage Package;
+	if (GetUGCPackageByModID(ModID, Package))
+	{
+		UnpinUGCPackage(Package);
+	}
+}
+
+bool UUGCSubsystem::EnsureUGCPackageResidentByModID(FGenericModID ModID, FUGCPackage& UGCPackage)
+{
+#if UGC_SUPPORTED_PLATFORM
+	if (GetUGCPackageByModID(ModID, UGCPackage))
+	{
+		return true;
+	}
+
+	const TOptional<FUGCResidencyTracker::FEvictedPackage> EvictedPackage = ResidencyTracker.TakeEvictedByModID(ModID);
+	if (!EvictedPackage.IsSet() || !RemountEvictedUGC(EvictedPackage.GetValue()))
+	{
+		return false;
+	}
+	return GetUGCPackageByModID(ModID, UGCPackage);
+#else
+	return false;
+#endif
+}
+
+bool UUGCSubsystem::IsUGCPackageEvictedByModID(FGenericModID ModID) const
+{
+	return ResidencyTracker.IsEvicted(ModID);
+}
+
+void UUGCSubsystem::EnforceUGCResidencyBudget()
+{
+#if UGC_SUPPORTED_PLATFORM
+	const UModioUGCSettings* UGCSettings = GetDefault<UModioUGCSettings>();
+	if (!UGCSettings || !UGCSettings->bEnableUGCResidencyManager)
+	{
+		return;
+	}
+
+	TRACE_CPUPROFILER_EVENT_SCOPE(UUGCSubsystem::EnforceUGCResidencyBudget);
+	const int64 BudgetBytes = static_cast<int64>(FMath::Max(UGCSettings->UGCResidencyBudgetMB, 1)) << 20;
+
+	// The footprints are computed when packages are mounted, so staying within the budget costs a single pass over them
+	int64 ResidentBytes = 0;
+	for (const FUGCPackage& Package : UGCPackages)
+	{
+		ResidentBytes += Package.GetState().MountedFootprintBytes;
+	}
+	if (ResidentBytes <= BudgetBytes)
+	{
+		return;
+	}
+
+	TMap<FName, FUGCPackage> PackagesByDescriptorPath;
+	PackagesByDescriptorPath.Reserve(UGCPackages.Num());
+	for (const FUGCPackage& Package : UGCPackages)
+	{
+		PackagesByDescriptorPath.Add(Package.GetInfo().DescriptorPath, Package);
+	}
+
+	for (const FName DescriptorPath : ResidencyTracker.GetEvictionOrder())
+	{
+		if (ResidentBytes <= BudgetBytes)
+		{
+			break;
+		}
+
+		// Packages with loaded content are in use, and unloading them would not free that content anyway
+		FUGCPackage* Package = PackagesByDescriptorPath.Find(DescriptorPath);
+		if (!Package || IsUGCPackageInUse(*Package))
+		{
+			continue;
+		}
+
+		const int64 FootprintBytes = Package->GetState().MountedFootprintBytes;
+		UE_LOG(LogModioUGC, Log, TEXT("Evicting UGC package %s (%lld bytes) to fit the residency budget"),
+			   *Package->GetFriendlyName(), FootprintBytes);
+		EvictUGCPackage(*Package);
+		ResidentBytes -= FootprintBytes;
+	}
+
+	if (ResidentBytes > BudgetBytes)
+	{
+		UE_LOG(LogModioUGC, Warning,
+			   TEXT("Mounted UGC uses %lld bytes, over the residency budget of %lld bytes, as the remaining packages "
+					"are pinned or in use"),
+			   ResidentBytes, BudgetBytes);
+	}
+#endif
+}
+
+bool UUGCSubsystem::IsUGCPackageInUse(const FUGCPackage& Package) const
+{
+	// The metadata stays loaded for as long as the package is mounted, so it does not mean the package is in use
+	const UUGC_Metadata* PackageMetadata = Package.GetState().PackageMetadata.Get();
+	const UPackage* MetadataPackage = PackageMetadata ? PackageMetadata->GetPackage() : nullptr;
+
+	FReadScopeLock ReadLock(PackageAttributionLock);
+	const TArray<FName>* PackageNames = IndexedPackageNames.Find(Package);
+	if (!PackageNames)
+	{
+		return false;
+	}
+	for (const FName PackageName : *PackageNames)
+	{
+		const UPackage* LoadedPackage = FindObjectFast<UPackage>(nullptr, PackageName);
+		if (LoadedPackage && LoadedPackage != MetadataPackage)
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+bool UUGCSubsystem::EnsureUGCPackageResidentForPackageName(FName PackageName, FUGCPackage& UGCPackage)
+{
+#if UGC_SUPPORTED_PLATFORM
+	if (AttributePackageName(PackageName, UGCPackage))
+	{
+		ResidencyTracker.Touch(UGCPackage.GetInfo().DescriptorPath);
+		return true;
+	}
+
+	const TOptional<FUGCResidencyTracker::FEvictedPackage> EvictedPackage =
+		ResidencyTracker.TakeEvictedByMountRoot(GetMountRoot(PackageName.ToString()));
+	if (!EvictedPackage.IsSet() || !RemountEvictedUGC(EvictedPackage.GetValue()))
+	{
+		return false;
+	}
+	return AttributePackageName(PackageName, UGCPackage);
+#else
+	return false;
+#endif
+}
+
+void UUGCSubsystem::OnPackageLoadRequested(const FString& PackageName)
+{
+	FUGCPackage Owner;
+	if (AttributePackageName(FName(*PackageName), Owner))
+	{
+		ResidencyTracker.Touch(Owner.GetInfo().DescriptorPath);
+		return;
+	}
+
+	TOptional<FUGCResidencyTracker::FEvictedPackage> EvictedPackage =
+		ResidencyTracker.TakeEvictedByMountRoot(GetMountRoot(PackageName));
+	if (!EvictedPackage.IsSet())
+	{
+		return;
+	}
+
+	// Mounting loads the package metadata and registers its assets, which must not happen from within a load request.
+	// Callers are expected to make evicted content resident before loading it, so this request fails and the package
+	// is only remounted on the next tick
+	UE_LOG(LogModioUGC, Warning,
+		   TEXT("Package %s was requested from evicted UGC and will fail to load, call "
+				"EnsureUGCPackageResidentForPackageName before loading content that may have been evicted"),
+		   *PackageName);
+	FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateWeakLambda(
+		this, [this, EvictedPackage = MoveTemp(EvictedPackage.GetValue())](float) {
+			RemountEvictedUGC(EvictedPackage);
+			return false;
+		}));
+}
+
+FName UUGCSubsystem::GetMountRoot(const FString& PackageName)
+{
+	// Package names look like "/RedSpaceship/Meshes/Hull", so the mount root is everything up to the second slash
+	if (PackageName.Len() < 2 || PackageName[0] != TEXT('/'))
+	{
+		return NAME_None;
+	}
+	const int32 MountRootEnd = PackageName.Find(TEXT("/"), ESearchCase::CaseSensitive, ESearchDir::FromStart, 1);
+	return FName(MountRootEnd == INDEX_NONE ? PackageName : PackageName.Left(MountRootEnd));
+}
+
+void UUGCSubsystem::EvictUGCPackage(FUGCPackage& Package)
+{
+	const TSharedPtr<IPlugin>& Plugin = Package.GetAssociatedPlugin();
+	if (!Plugin)
+	{
+		return;
+	}
+
+	FUGCResidencyTracker::FEvictedPackage EvictedPackage;
+	EvictedPackage.DescriptorPath = Plugin->GetDescriptorFileName();
+	EvictedPackage.MountRoot = Package.GetInfo().PackagePath;
+	EvictedPackage.ModID = Package.GetModID();
+	EvictedPackage.LoadPriority = Package.GetState().LoadPriority;
+
+	UnloadUGC(Package);
+	ResidencyTracker.AddEvicted(MoveTemp(EvictedPackage));
+}
+
+bool UUGCSubsystem::RemountEvictedUGC(const FUGCResidencyTracker::FEvictedPackage& EvictedPackage)
+{
+#if UGC_SUPPORTED_PLATFORM
+	TRACE_CPUPROFILER_EVENT_SCOPE(UUGCSubsystem::RemountEvictedUGC);
+	FText FailReason;
+	if (!IPluginManager::Get().AddToPluginsList(EvictedPackage.DescriptorPath, &FailReason))
+	{
+		UE_LOG(LogModioUGC, Error, TEXT("Failed to remount evicted UGC %s: %s"), *EvictedPackage.DescriptorPath,
+			   *FailReason.ToString());
+		return false;
+	}
+
+	const TSharedPtr<IPlugin> Plugin =
+		IPluginManager::Get().FindPlugin(FPaths::GetBaseFilename(EvictedPackage.DescriptorPath));
+	if (!LoadUGC(Plugin, EvictedPackage.ModID, EvictedPackage.LoadPriority))
+	{
+		UE_LOG(LogModioUGC, Error, TEXT("Failed to remount evicted UGC %s"), *EvictedPackage.DescriptorPath);
+		return false;
+	}
+
+	OnUGCPackagesChanged.Broadcast();
+
+	// Make room for the remounted package on the next tick, as content may be loading from it right now. It stays
+	// pinned until then so it isn't evicted before that content is loaded
+	const FName DescriptorPath(EvictedPackage.DescriptorPath);
+	ResidencyTracker.Pin(DescriptorPath);
+	FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateWeakLambda(this, [this, DescriptorPath](float) {
+		EnforceUGCResidencyBudget();
+		ResidencyTracker.Unpin(DescriptorPath);
+		return false;
+	}));
+	return true;
+#else
+	return false;
+#endif
+}
+
+FUGCPackageMemoryReport UUGCSubsystem::GetUGCPackageMemoryReport(const FUGCPackage& UGCPackage) const
+{
+	TArray<FUGCPackageMemoryReport> Reports;
+	Reports.Add(BuildMemoryReport(UGCPackage));
+	AddResidentObjectsToMemoryReports(Reports);
+	return Reports[0];
+}
+
+TArray<FUGCPackageMemoryReport> UUGCSubsystem::GetUGCMemoryReport() const
+{
+	TArray<FUGCPackageMemoryReport> Reports;
+	Reports.Reserve(UGCPackages.Num());
+	for (const FUGCPackage& Package : UGCPackages)
+	{
+		Reports.Add(BuildMemoryReport(Package));
+	}
+	AddResidentObjectsToMemoryReports(Reports);
+	Reports.Sort([](const FUGCPackageMemoryReport& A, const FUGCPackageMemoryReport& B) {
+		return A.TotalBytes > B.TotalBytes;
+	});
+	return Reports;
+}
+
+void UUGCSubsystem::LogUGCMemoryReport() const
+{
+	DumpUGCMemoryReport(*GLog);
+}
+
+void UUGCSubsystem::DumpUGCMemoryReport(FOutputDevice& Ar) const
+{
+	const TArray<FUGCPackageMemoryReport> Reports = GetUGCMemoryReport();
+	auto ToKB = [](int64 Bytes) { return static_cast<double>(Bytes) / 1024.0; };
+
+	Ar.Logf(TEXT("UGC memory report for %d packages (KB):"), Reports.Num());
+	Ar.Logf(TEXT("%10s %10s %10s %10s %10s %10s %10s %8s %10s  %s"), TEXT("Total"), TEXT("UpperBound"),
+			TEXT("PakIndex"), TEXT("FileIndex"), TEXT("Registry"), TEXT("Global"), TEXT("Objects"), TEXT("NumObj"),
+			TEXT("Shaders"), TEXT("Package"));
+
+	int64 TotalBytes = 0;
+	int64 TotalUpperBoundBytes = 0;
+	for (const FUGCPackageMemoryReport& Report : Reports)
+	{
+		Ar.Logf(TEXT("%10.1f %10.1f %10.1f %10.1f %10.1f %10.1f %10.1f %8d %9.1f%s  %s%s"), ToKB(Report.TotalBytes),
+				ToKB(Report.TotalUpperBoundBytes), ToKB(Report.PakIndexBytes), ToKB(Report.FileIndexBytes),
+				ToKB(Report.LoadedAssetRegistryBytes), ToKB(Report.GlobalAssetRegistryBytes),
+				ToKB(Report.ResidentObjectBytes), Report.NumResidentObjects, ToKB(Report.ShaderArchiveBytes),
+				Report.bShaderLibraryOpen ? TEXT("*") : TEXT(" "), *Report.Package.GetFriendlyName(),
+				Report.Package.GetMountState() == EUGCPackageMountState::EUPMS_Hidden ? TEXT(" (hidden)") : TEXT(""));
+		TotalBytes += Report.TotalBytes;
+		TotalUpperBoundBytes += Report.TotalUpperBoundBytes;
+	}
+
+	Ar.Logf(TEXT("%10.1f KB in total, %.1f KB upper bound. Global registry and shader archive sizes are estimates, "
+				 "* marks open libraries"),
+			ToKB(TotalBytes), ToKB(TotalUpperBoundBytes));
+}
+
+FUGCPackageMemoryReport UUGCSubsystem::BuildMemoryReport(const FUGCPackage& Package) const
+{
+	FUGCPackageMemoryReport Report;
+	Report.Package = Package;
+	const FUGCPackageState& State = Package.GetState();
+
+	Report.PakIndexBytes = State.PakIndexBytes;
+
+	if (State.FileIndex.IsValid())
+	{
+		Report.FileIndexBytes = State.FileIndex->GetAllocatedSize();
+
+		TArray<FString> ShaderArchivePaths;
+		State.FileIndex->FindMatches(TEXT("*.ushaderbytecode"), ShaderArchivePaths);
+		IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+		for (const FString& ShaderArchivePath : ShaderArchivePaths)
+		{
+			Report.ShaderArchiveBytes += FMath::Max<int64>(PlatformFile.FileSize(*ShaderArchivePath), 0);
+		}
+	}
+
+	if (State.LoadedAssetRegistryState.IsValid())
+	{
+		Report.LoadedAssetRegistryBytes = State.LoadedAssetRegistryState->GetAllocatedSize();
+		// The loaded state is appended to the global registry as soon as it is loaded
+		Report.GlobalAssetRegistryBytes = Report.LoadedAssetRegistryBytes;
+	}
+
+	if (const TSharedPtr<IPlugin>& Plugin = Package.GetAssociatedPlugin())
+	{
+		Report.bShaderLibraryOpen = FUGCShaderLibraryRegistry::Get().IsOpen(Plugin->GetName());
+	}
+
+	return Report;
+}
+
+void UUGCSubsystem::AddResidentObjectsToMemoryReports(TArray<FUGCPackageMemoryReport>& Reports) const
+{
+	TMap<FUGCPackage, int32> ReportIndices;
+	for (int32 ReportIndex = 0; ReportIndex < Reports.Num(); ++ReportIndex)
+	{
+		ReportIndices.Add(Reports[ReportIndex].Package, ReportIndex);
+	}
+
+	// A single pass over the loaded packages, attributed through the package name index
+	for (TObjectIterator<UPackage> It; It; ++It)
+	{
+		FUGCPackage Owner;
+		if (!AttributePackageName(It->GetFName(), Owner))
+		{
+			continue;
+		}
+		const int32* ReportIndex = ReportIndices.Find(Owner);
+		if (!ReportIndex)
+		{
+			continue;
+		}
+
+		FUGCPackageMemoryReport& Report = Reports[*ReportIndex];
+		// The metadata stays loaded for as long as the package is mounted, so it does not mean the package is in use
+		const UUGC_Metadata* PackageMetadata = Report.Package.GetState().PackageMetadata.Get();
+		if (!PackageMetadata || PackageMetadata->GetPackage() != *It)
+		{
+			++Report.NumResidentPackages;
+		}
+		ForEachObjectWithPackage(
+			*It,
+			[&Report](UObject* Object) {
+				++Report.NumResidentObjects;
+				Report.ResidentObjectBytes += Object->GetResourceSizeBytes(EResourceSizeMode::Exclusive);
+				return true;
+			},
+			true);
+	}
+
+	for (FUGCPackageMemoryReport& Report : Reports)
+	{
+		Report.TotalBytes = Report.PakIndexBytes + Report.FileIndexBytes + Report.LoadedAssetRegistryBytes +
+							Report.ResidentObjectBytes;
+		Report.TotalUpperBoundBytes = Report.TotalBytes + Report.GlobalAssetRegistryBytes +
+									  (Report.bShaderLibraryOpen ? Report.ShaderArchiveBytes : 0);
+	}
+}
+
+bool UUGCSubsystem::MountUGCByModID(FGenericModID ModID, const FString& UGCPath)
+{
+#if UGC_SUPPORTED_PLATFORM
+	TRACE_CPUPROFILER_EVENT_SCOPE(UUGCSubsystem::MountUGCByModID);
+
+	UnloadUGCByModID_Internal(ModID);
+
+	FModUGCPathMap UGCPathMap;
+	UGCPathMap.PathToModIDMap.Add(UGCPath, ModID);
+	CachedInstalledUGCPaths += UGCPathMap;
+	if (!MountUGCPaths(UGCPathMap, true))
+	{
+		UE_LOG(LogModioUGC, Warning, TEXT("No UGC was mounted for the mod installed at '%s'"), *UGCPath);
+		return false;
+	}
+
+	EnforceUGCResidencyBudget();
+	OnUGCPackagesChanged.Broadcast();
+	return true;
+#else
+	return false;
+#endif
+}
+
+bool UUGCSubsystem::HandleModManagementEvent(FGenericModID ModID, EUGCModManagementEvent Event,
+											 TFunctionRef<FString()> GetInstalledPath)
+{
+#if UGC_SUPPORTED_PLATFORM
+	switch (Event)
+	{
+		// Loaded assets and mounted pak files would keep the files mod management is about to replace or delete in
+		// use. Evicted UGC of the mod is forgotten as well, as it must not be remounted from those files
+		case EUGCModManagementEvent::BeginUpdate:
+		case EUGCModManagementEvent::BeginUninstall:
+		case EUGCModManagementEvent::Uninstalled:
+			UE_LOG(LogModioUGC, Verbose, TEXT("Unloading UGC of a mod for mod management"));
+			UnloadUGCByModID_Internal(ModID);
+			ResidencyTracker.RemoveEvictedByModID(ModID);
+			if (Event == EUGCModManagementEvent::Uninstalled)
+			{
+				CachedInstalledUGCPaths.PathToModIDMap = CachedInstalledUGCPaths.PathToModIDMap.FilterByPredicate(
+					[ModID](const TPair<FString, FGenericModID>& UGCPath) { return UGCPath.Value != ModID; });
+			}
+			return true;
+
+		// A failed update leaves the previous version installed, which is mounted again
+		case EUGCModManagementEvent::Installed:
+		case EUGCModManagementEvent::Updated:
+		{
+			const FString UGCPath = GetInstalledPath();
+			if (UGCPath.IsEmpty())
+			{
+				return true;
+			}
+			UE_LOG(LogModioUGC, Log, TEXT("Mounting UGC of the mod installed at '%s'"), *UGCPath);
+			return MountUGCByModID(ModID, UGCPath);
+		}
+
+		default:
+			return true;
+	}
+#else
+	return false;
+#endif
+}
+
+bool UUGCSubsystem::LoadUGCByModID(FGenericModID ModID)
+{
+#if UGC_SUPPORTED_PLATFORM
+	TRACE_CPUPROFILER_EVENT_SCOPE(UUGCSubsystem::LoadUGCByModID);
+
+	FUGCPackage ExistingPackage;
+	if (GetUGCPackageByModID(ModID, ExistingPackage))
+	{
+		UE_LOG(LogModioUGC, VeryVerbose, TEXT("UGC for mod '%s' is already loaded, skipping"),
+			   *ExistingPackage.GetFriendlyName());
+		return true;
+	}
+
+	if (!UGCProvider.GetObject())
+	{
+		UE_LOG(LogModioUGC, Warning, TEXT("UGC provider is not available, unable to load UGC by mod ID"));
+		return false;
+	}
+
+	const FModUGCPathMap InstalledUGCPaths = IUGCProvider::Execute_GetInstalledUGCPaths(UGCProvider.GetObject());
+	CachedInstalledUGCPaths = InstalledUGCPaths;
+	FModUGCPathMap UGCPathMap;
+	for (const TPair<FString, FGenericModID>& UGCPath : InstalledUGCPaths.PathToModIDMap)
+	{
+		if (UGCPath.Value == ModID)
+		{
+			UGCPathMap.PathToModIDMap.Add(UGCPath.Key, ModID);
+		}
+	}
+	if (UGCPathMap.PathToModIDMap.IsEmpty())
+	{
+		UE_LOG(LogModioUGC, Warning, TEXT("Failed to load UGC by mod ID since the mod is not installed"));
+		return false;
+	}
+
+	if (!MountUGCPaths(UGCPathMap, true))
+	{
+		return false;
+	}
+
+	EnforceUGCResidencyBudget();
+	OnUGCPackagesChanged.Broadcast();
+	return true;
+#else
+	return false;
+#endif
+}
+
+bool UUGCSubsystem::RefreshUGCForPath(const FString& Path)
+{
+#if UGC_SUPPORTED_PLATFORM
+	TRACE_CPUPROFILER_EVENT_SCOPE(UUGCSubsystem::RefreshUGCForPath);
+
+	// Packages under the path whose descriptor is gone are unmounted
+	bool bWasAnyUGCUnloaded = false;
+	TArray<FUGCPackage> InternalUGCPackages = UGCPackages.Array();
+	for (FUGCPackage& UGCPackage : InternalUGCPackages)
+	{
+		const FString DescriptorPath = UGCPackage.GetInfo().DescriptorPath.ToString();
+		if (FPaths::IsUnderDirectory(FPaths::GetPath(DescriptorPath), Path) && !FPaths::FileExists(DescriptorPath))
+		{
+			bWasAnyUGCUnloaded |= UnloadUGC(UGCPackage);
+		}
+	}
+
+	// New plugins are associated with the mod installed at the path, if the UGC provider knows of one
+	TOptional<FGenericModID> ModID;
+	if (UGCProvider.GetObject())
+	{
+		const FModUGCPathMap InstalledUGCPaths = IUGCProvider::Execute_GetInstalledUGCPaths(UGCProvider.GetObject());
+		CachedInstalledUGCPaths = InstalledUGCPaths;
+		for (const TPair<FString, FGenericModID>& UGCPath : InstalledUGCPaths.PathToModIDMap)
+		{
+			if (FPaths::IsUnderDirectory(Path, UGCPath.Key))
+			{
+				ModID = UGCPath.Value;
+				break;
+			}
+		}
+	}
+
+	FModUGCPathMap UGCPathMap;
+	UGCPathMap.PathToModIDMap.Add(Path, ModID.Get(FGenericModID()));
+	const bool bWasAnyUGCLoaded = MountUGCPaths(UGCPathMap, true, ModID.IsSet());
+
+	if (bWasAnyUGCUnloaded || bWasAnyUGCLoaded)
+	{
+		EnforceUGCResidencyBudget();
+		OnUGCPackagesChanged.Broadcast();
+	}
+	return bWasAnyUGCLoaded;
+#else
+	return false;
+#endif
+}
+
+void UUGCSubsystem::UnmountUGCPackageByModID(FGenericModID ModID, bool bRemoveUGCPackage)
+{
+#if UGC_SUPPORTED_PLATFORM
+	// UnmountUGCPackage modifies the UGCPackages array, so we need to make a copy to iterate over
+	TArray<FUGCPackage> UGCPackagesCopy = UGCPackages.Array();
+
+	// Not using EnumerateAllUGCPackages because we want mutable refs
+	for (FUGCPackage& CurrentPackage : UGCPackagesCopy)
+	{
+		if (CurrentPackage.GetModID().IsSet() && CurrentPackage.GetModID().GetValue() == ModID)
+		{
+			UnmountUGCPackage(CurrentPackage, bRemoveUGCPackage);
+		}
+	}
+#endif
+}
+
+void UUGCSubsystem::UnmountUGCPackage(FUGCPackage& Package, bool bRemoveUGCPackage)
+{
+#if UGC_SUPPORTED_PLATFORM
+	RetainForWarmRemount(Package);
+	UnmountAndUnregisterUGCPackage(Package, bRemoveUGCPackage);
+#endif
+}
+
+void UUGCSubsystem::UnmountAndUnregisterUGCPackage(FUGCPackage& Package, bool bRemoveUGCPackage)
+{
+#if UGC_SUPPORTED_PLATFORM
+	UnmountUGCPackage_Internal(Package);
+
+	if (bRemoveUGCPackage)
+	{
+		UGCPackages.Remove(Package);
+		RemoveUGCPackageFromAttributionIndex(Package);
+		ResidencyTracker.RemoveResident(Package.GetInfo().DescriptorPath);
+		ConflictIndex.RemovePackage(Package);
+		LoadedUGCPlugins.Remove(FName(Package.GetAssociatedPlugin()->GetDescriptorFileName()));
+	}
+
+	OnUGCPackagesChanged.Broadcast();
+#endif
+}
+
+void UUGCSubsystem::UnmountUGCPackage_Internal(FUGCPackage& Package)
+{
+#if UGC_SUPPORTED_PLATFORM
+	FScopedPlatformPakFileOverride PlatformPakFile {};
+
+	UE_LOG(LogModioUGC, Verbose, TEXT("Unmounting UGC Package %s"), *Package.GetFriendlyName());
+
+	for (const FString& PakFile : Package.GetState().MountedPakFilePaths)
+	{
+		UE_LOG(LogModioUGC, VeryVerbose, TEXT("Unmounting UGC pak file %s"), *PakFile);
+		PlatformPakFile->Unmount(*PakFile);
+	}
+
+	Package.GetMutableState().MountState = EUGCPackageMountState::EUPMS_Unmounted;
+	Package.GetMutableState().PakIndexBytes = 0;
+	Package.GetMutableState().MountedFootprintBytes = 0;
+
+	if (!Package.GetAssociatedPlugin())
+	{
+		UE_LOG(LogModioUGC, Warning, TEXT("Associated plugin for UGC package %s is null!"), *Package.GetFriendlyName());
+		return;
+	}
+
+	UE_LOG(LogModioUGC, Verbose, TEXT("Removing AssetRegistry entries for %s"), *Package.GetFriendlyName());
 
-	UE_LOG(LogModioUGC, Verbose, TEXT("Removing AssetRegistry entries for %s"), *Package.FriendlyName);
-
 	#if !WITH_EDITOR
 	//  Remove the automatically-added, incorrect content mount point that the Plugin manager added.
-	FPackageName::UnRegisterMountPoint(Package.AssociatedPlugin->GetMountedAssetPath(),
-									   Package.AssociatedPlugin->GetContentDir());
+	FPackageName::UnRegisterMountPoint(Package.GetAssociatedPlugin()->GetMountedAssetPath(),
+									   Package.GetAssociatedPlugin()->GetContentDir());
 	#endif
 
 	// Remove our manually added mount point.
 	FString RootPath;
 	FString ContentPath;
-	if (GetModMountPoint(Package.AssociatedPlugin, RootPath, ContentPath))
+	if (GetModMountPoint(Package.GetAssociatedPlugin(), RootPath, ContentPath))
 	{
 		FPackageName::UnRegisterMountPoint(RootPath, ContentPath);
 	}
 
-	if (Package.AssociatedPlugin->IsEnabled())
+	if (Package.GetAssociatedPlugin()->IsEnabled())
 	{
 	#if WITH_EDITOR
 		FPackageName::FOnContentPathDismountedEvent PathDismountedEvent = FPackageName::OnContentPathDismounted();
@@ -715,19 +2037,19 @@ void UUGCSubsystem::UnmountUGCPackage_Internal(FUGCPackage& Package)
 	#endif
 		FText FailReason;
 		// Unmounts and disables the plugin
-		if (IPluginManager::Get().UnmountExplicitlyLoadedPlugin(Package.AssociatedPlugin->GetName(), &FailReason))
+		if (IPluginManager::Get().UnmountExplicitlyLoadedPlugin(Package.GetAssociatedPlugin()->GetName(), &FailReason))
 		{
 			IPluginManager::Get().RefreshPluginsList();
 		}
 		else
 		{
-			UE_LOG(LogModioUGC, Error, TEXT("Plugin %s cannot be unloaded: %s"), *Package.AssociatedPlugin->GetName(),
-				   *FailReason.ToString());
+			UE_LOG(LogModioUGC, Error, TEXT("Plugin %s cannot be unloaded: %s"),
+				   *Package.GetAssociatedPlugin()->GetName(), *FailReason.ToString());
 		}
 
 		TArray<FString> FileNames;
 		FPlatformFileManager::Get().GetPlatformFile().FindFilesRecursively(
-			FileNames, *Package.AssociatedPlugin->GetBaseDir(), TEXT(".uplugin"));
+			FileNames, *Package.GetAssociatedPlugin()->GetBaseDir(), TEXT(".uplugin"));
 		for (const FString& PluginFileName : FileNames)
 		{
 			FText OutFailReason;
@@ -795,11 +2117,11 @@ bool UUGCSubsystem::IsUGCFeatureEnabled(EUGCSubsystemFeature Feature)
 TArray<FName> UUGCSubsystem::GetPackageNamesFromUGCPackage(const FUGCPackage& UGCPackage) const
 {
 #if UGC_SUPPORTED_PLATFORM
-	FScopedPlatformPakFileOverride PlatformPakFile {};
+	// The registry state is held in memory, so there is no need to go through the pak platform file
 	TArray<FName> PackageNames;
-	if (UGCPackage.LoadedAssetRegistryState)
+	if (UGCPackage.GetState().LoadedAssetRegistryState)
 	{
-		UGCPackage.LoadedAssetRegistryState->GetPackageNames(PackageNames);
+		UGCPackage.GetState().LoadedAssetRegistryState->GetPackageNames(PackageNames);
 	}
 	return PackageNames;
 #else
@@ -807,6 +2129,206 @@ TArray<FName> UUGCSubsystem::GetPackageNamesFromUGCPackage(const FUGCPackage& UG
 #endif
 }
 
+bool UUGCSubsystem::FileExistsInUGC(const FUGCPackage& UGCPackage, const FString& FilePath) const
+{
+	if (UGCPackage.GetMountState() == EUGCPackageMountState::EUPMS_Hidden)
+	{
+		return false;
+	}
+	const TSharedPtr<const FUGCFileIndex>& FileIndex = UGCPackage.GetState().FileIndex;
+	return FileIndex.IsValid() && FileIndex->Contains(FilePath);
+}
+
+TArray<FString> UUGCSubsystem::FindFilesInUGC(const FUGCPackage& UGCPackage, const FString& Wildcard) const
+{
+	TArray<FString> FilePaths;
+	if (UGCPackage.GetMountState() == EUGCPackageMountState::EUPMS_Hidden)
+	{
+		return FilePaths;
+	}
+	if (const TSharedPtr<const FUGCFileIndex>& FileIndex = UGCPackage.GetState().FileIndex)
+	{
+		FileIndex->FindMatches(Wildcard, FilePaths);
+	}
+	return FilePaths;
+}
+
+TArray<FUGCPackageConflict> UUGCSubsystem::GetUGCPackageConflicts() const
+{
+	return ConflictIndex.GetConflicts();
+}
+
+TArray<FUGCPackageConflict> UUGCSubsystem::GetConflictsForUGCPackage(const FUGCPackage& UGCPackage) const
+{
+	return ConflictIndex.GetConflictsForPackage(UGCPackage);
+}
+
+void UUGCSubsystem::LogUGCPackageConflicts() const
+{
+	ConflictIndex.LogSummary();
+}
+
+bool UUGCSubsystem::FindUGCPackageForPackageName(FName PackageName, FUGCPackage& UGCPackage) const
+{
+	// Hidden packages are still mounted, but are not exposed
+	FUGCPackage Owner;
+	if (!AttributePackageName(PackageName, Owner) || Owner.GetMountState() == EUGCPackageMountState::EUPMS_Hidden)
+	{
+		return false;
+	}
+	UGCPackage = MoveTemp(Owner);
+	return true;
+}
+
+bool UUGCSubsystem::AttributePackageName(FName PackageName, FUGCPackage& UGCPackage) const
+{
+#if UGC_SUPPORTED_PLATFORM
+	if (PackageName.IsNone())
+	{
+		return false;
+	}
+
+	FReadScopeLock ReadLock(PackageAttributionLock);
+	if (const FUGCPackage* FoundPackage = PackageNameToUGCPackageMap.Find(PackageName))
+	{
+		UGCPackage = *FoundPackage;
+		return true;
+	}
+
+	const FString PackageNameString = PackageName.ToString();
+	const FStringView PackageNameView = PackageNameString;
+
+	// Object paths look like "/RedSpaceship/Meshes/Hull.Hull", so retry with the package part only
+	int32 ObjectSeparatorIndex = INDEX_NONE;
+	if (PackageNameView.FindChar(TEXT('.'), ObjectSeparatorIndex))
+	{
+		const FName ObjectPackageName(PackageNameView.Left(ObjectSeparatorIndex), FNAME_Find);
+		if (const FUGCPackage* FoundPackage = PackageNameToUGCPackageMap.Find(ObjectPackageName))
+		{
+			UGCPackage = *FoundPackage;
+			return true;
+		}
+	}
+
+	// Packages missing from the registry (e.g. generated at runtime) are attributed to the UGC package owning the
+	// mount root, which is everything up to the second slash
+	if (PackageNameView.Len() < 2 || PackageNameView[0] != TEXT('/'))
+	{
+		return false;
+	}
+	const int32 MountRootEnd = PackageNameString.Find(TEXT("/"), ESearchCase::CaseSensitive, ESearchDir::FromStart, 1);
+	FStringView MountRoot = MountRootEnd == INDEX_NONE ? PackageNameView : PackageNameView.Left(MountRootEnd);
+	int32 MountRootObjectSeparatorIndex = INDEX_NONE;
+	if (MountRoot.FindChar(TEXT('.'), MountRootObjectSeparatorIndex))
+	{
+		MountRoot.LeftInline(MountRootObjectSeparatorIndex);
+	}
+	if (const FUGCPackage* FoundPackage = MountRootToUGCPackageMap.Find(FName(MountRoot, FNAME_Find)))
+	{
+		UGCPackage = *FoundPackage;
+		return true;
+	}
+#endif
+	return false;
+}
+
+bool UUGCSubsystem::FindUGCPackageForObject(const UObject* Object, FUGCPackage& UGCPackage) const
+{
+	if (!Object)
+	{
+		return false;
+	}
+	return FindUGCPackageForPackageName(Object->GetPackage()->GetFName(), UGCPackage);
+}
+
+void UUGCSubsystem::AddUGCPackageToAttributionIndex(const FUGCPackage& Package)
+{
+	TArray<FName> PackageNames;
+	if (const TSharedPtr<FAssetRegistryState>& RegistryState = Package.GetState().LoadedAssetRegistryState)
+	{
+		RegistryState->GetPackageNames(PackageNames);
+	}
+
+	FWriteScopeLock WriteLock(PackageAttributionLock);
+	PackageNameToUGCPackageMap.Reserve(PackageNameToUGCPackageMap.Num() + PackageNames.Num());
+	for (const FName PackageName : PackageNames)
+	{
+		// When several packages ship the same package, the first one in load order is the one loaded
+		FUGCPackage* ExistingPackage = PackageNameToUGCPackageMap.Find(PackageName);
+		if (!ExistingPackage)
+		{
+			PackageNameToUGCPackageMap.Add(PackageName, Package);
+			continue;
+		}
+
+		TArray<FUGCPackage>& Providers = SharedPackageNameProviders.FindOrAdd(PackageName);
+		if (Providers.IsEmpty())
+		{
+			Providers.Add(*ExistingPackage);
+		}
+		Providers.Add(Package);
+		if (FUGCPackage::LoadOrderPredicate(Package, *ExistingPackage))
+		{
+			*ExistingPackage = Package;
+		}
+	}
+	MountRootToUGCPackageMap.Add(Package.GetInfo().PackagePath, Package);
+	UE_LOG(LogModioUGC, VeryVerbose, TEXT("Indexed %d package names for UGC package %s"), PackageNames.Num(),
+		   *Package.GetFriendlyName());
+	IndexedPackageNames.Add(Package, MoveTemp(PackageNames));
+}
+
+void UUGCSubsystem::RemoveUGCPackageFromAttributionIndex(const FUGCPackage& Package)
+{
+	// The registry state of the package may already have been released, so the names indexed for it are used
+	FWriteScopeLock WriteLock(PackageAttributionLock);
+	TArray<FName> PackageNames;
+	IndexedPackageNames.RemoveAndCopyValue(Package, PackageNames);
+	for (const FName PackageName : PackageNames)
+	{
+		TArray<FUGCPackage>* Providers = SharedPackageNameProviders.Find(PackageName);
+		if (!Providers)
+		{
+			const FUGCPackage* Owner = PackageNameToUGCPackageMap.Find(PackageName);
+			if (Owner && *Owner == Package)
+			{
+				PackageNameToUGCPackageMap.Remove(PackageName);
+			}
+			continue;
+		}
+
+		// Hand the name over to the remaining provider that comes first in load order
+		Providers->Remove(Package);
+		const FUGCPackage* NextOwner = nullptr;
+		for (const FUGCPackage& Provider : *Providers)
+		{
+			if (!NextOwner || FUGCPackage::LoadOrderPredicate(Provider, *NextOwner))
+			{
+				NextOwner = &Provider;
+			}
+		}
+		if (NextOwner)
+		{
+			PackageNameToUGCPackageMap.Add(PackageName, *NextOwner);
+		}
+		else
+		{
+			PackageNameToUGCPackageMap.Remove(PackageName);
+		}
+		if (Providers->Num() <= 1)
+		{
+			SharedPackageNameProviders.Remove(PackageName);
+		}
+	}
+	if (const FUGCPackage* MountRootPackage = MountRootToUGCPackageMap.Find(Package.GetInfo().PackagePath))
+	{
+		if (*MountRootPackage == Package)
+		{
+			MountRootToUGCPackageMap.Remove(Package.GetInfo().PackagePath);
+		}
+	}
+}
+
 void UUGCSubsystem::RemoveModEnabledStateChangeHandler(const FModEnabledStateChangeHandler& Handler)
 {
 	OnModEnabledStateChanged.Remove(Handler);
@@ -815,4 +2337,14 @@ void UUGCSubsystem::RemoveModEnabledStateChangeHandler(const FModEnabledStateCha
 void UUGCSubsystem::AddModEnabledStateChangeHandler(const FModEnabledStateChangeHandler& Handler)
 {
 	OnModEnabledStateChanged.AddUnique(Handler);
+}
+
+void UUGCSubsystem::RemoveModEnabledStatesChangeHandler(const FModEnabledStatesChangeHandler& Handler)
+{
+	OnModEnabledStatesChanged.Remove(Handler);
+}
+
+void UUGCSubsystem::AddModEnabledStatesChangeHandler(const FModEnabledStatesChangeHandler& Handler)
+{
+	OnModEnabledStatesChanged.AddUnique(Handler);
 }
\ No newline at end of file
@@ -0,0 +1,123 @@
+/*
+ *  Copyright (C) 2025-2026 mod.io Pty Ltd. <https://mod.io>
+ *
+ *  This file is part of the mod.io ModioUGC Plugin.
+ *
+ *  Distributed under the MIT License. (See accompanying file LICENSE or
+ *   view online at <https://github.com/modio/modio-ue-modiougc/blob/main/LICENSE>)
+ *
+ */
+
+#include "UGC/Utilities/SideLoadUGCScanner.h"
+
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
+#include "ModioUGC.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+
+FModUGCPathMap FSideLoadUGCScanner::Scan(const TArray<FString>& Roots, const FString& ModIDFileName)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FSideLoadUGCScanner::Scan);
+	FScopeLock ScopeLock(&Lock);
+
+	IFileManager& FileManager = IFileManager::Get();
+	TMap<FString, FGenericModID> UGCPathsToModIDs;
+	TSet<FGenericModID> SeenModIDs;
+	for (const FString& Root : Roots)
+	{
+		const FFileStatData RootStat = FileManager.GetStatData(*Root);
+		if (!RootStat.bIsValid || !RootStat.bIsDirectory)
+		{
+			UE_LOG(LogModioUGC, Verbose, TEXT("Side-load UGC root '%s' does not exist"), *Root);
+			CachedRoots.Remove(Root);
+			continue;
+		}
+
+		FCachedRoot& CachedRoot = CachedRoots.FindOrAdd(Root);
+		if (CachedRoot.ModificationTime != RootStat.ModificationTime)
+		{
+			UE_LOG(LogModioUGC, Verbose, TEXT("Listing side-load UGC root '%s'"), *Root);
+			CachedRoot.ModificationTime = RootStat.ModificationTime;
+			CachedRoot.FolderNames.Reset();
+			FileManager.FindFiles(CachedRoot.FolderNames, *(Root / TEXT("*")), false, true);
+			CachedRoot.FolderNames.Sort();
+		}
+
+		for (const FString& FolderName : CachedRoot.FolderNames)
+		{
+			const FString FolderPath = Root / FolderName;
+			const FGenericModID ModID = ResolveModID(FolderPath, FolderName, ModIDFileName);
+			if (ModID != FGenericModID())
+			{
+				if (SeenModIDs.Contains(ModID))
+				{
+					UE_LOG(LogModioUGC, Verbose,
+						   TEXT("Skipping side-load UGC '%s', its mod ID is provided by a higher priority root"),
+						   *FolderPath);
+					continue;
+				}
+				SeenModIDs.Add(ModID);
+			}
+			UGCPathsToModIDs.Add(FolderPath, ModID);
+		}
+	}
+
+	return FModUGCPathMap(MoveTemp(UGCPathsToModIDs));
+}
+
+FGenericModID FSideLoadUGCScanner::ParseModIDFromFolderName(const FString& FolderName)
+{
+	int32 NumDigits = 0;
+	while (NumDigits < FolderName.Len() && FChar::IsDigit(FolderName[NumDigits]))
+	{
+		++NumDigits;
+	}
+
+	const bool bHasSeparator = NumDigits == FolderName.Len() || FolderName[NumDigits] == TEXT('_') ||
+							   FolderName[NumDigits] == TEXT('-') || FolderName[NumDigits] == TEXT(' ');
+	if (NumDigits == 0 || !bHasSeparator)
+	{
+		return FGenericModID();
+	}
+	return FGenericModID(FCString::Atoi64(*FolderName.Left(NumDigits)));
+}
+
+FGenericModID FSideLoadUGCScanner::ResolveModID(const FString& FolderPath, const FString& FolderName,
+												const FString& ModIDFileName)
+{
+	if (!ModIDFileName.IsEmpty())
+	{
+		const FString ModIDFilePath = FolderPath / ModIDFileName;
+		const FFileStatData ModIDFileStat = IFileManager::Get().GetStatData(*ModIDFilePath);
+		if (ModIDFileStat.bIsValid && !ModIDFileStat.bIsDirectory)
+		{
+			FCachedModIDFile& CachedModIDFile = CachedModIDFiles.FindOrAdd(ModIDFilePath);
+			if (CachedModIDFile.ModificationTime != ModIDFileStat.ModificationTime)
+			{
+				FString ModIDString;
+				FFileHelper::LoadFileToString(ModIDString, *ModIDFilePath);
+				ModIDString.TrimStartAndEndInline();
+				CachedModIDFile.ModificationTime = ModIDFileStat.ModificationTime;
+				CachedModIDFile.ModID =
+					ModIDString.IsNumeric() ? FGenericModID(FCString::Atoi64(*ModIDString)) : FGenericModID();
+				if (!ModIDString.IsNumeric())
+				{
+					UE_LOG(LogModioUGC, Warning, TEXT("Ignoring invalid mod ID '%s' in '%s'"), *ModIDString,
+						   *ModIDFilePath);
+				}
+			}
+			if (CachedModIDFile.ModID != FGenericModID())
+			{
+				return CachedModIDFile.ModID;
+			}
+		}
+		else
+		{
+			CachedModIDFiles.Remove(ModIDFilePath);
+		}
+	}
+
+	return ParseModIDFromFolderName(FolderName);
+}
@@ -0,0 +1,68 @@
+/*
+ *  Copyright (C) 2025-2026 mod.io Pty Ltd. <https://mod.io>
+ *
+ *  This file is part of the mod.io ModioUGC Plugin.
+ *
+ *  Distributed under the MIT License. (See accompanying file LICENSE or
+ *   view online at <https://github.com/modio/modio-ue-modiougc/blob/main/LICENSE>)
+ *
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+#include "UGC/UGCProvider.h"
+
+/**
+ * Finds the UGC folders under side-load roots, caching the result per directory.
+ *
+ * Each UGC folder is a direct child of a root. A root is only listed again when its modification time changed, and a
+ * mod ID file is only read again when its own modification time changed, so scans of unchanged roots only stat the
+ * roots and the mod ID files. Scans can run on any thread.
+ */
+class FSideLoadUGCScanner
+{
+public:
+	/**
+	 * Scans the roots for UGC folders. A mod ID found in more than one root is only provided by the first root
+	 *
+	 * @param Roots Absolute root directories, in priority order
+	 * @param ModIDFileName Name of the file holding the mod ID of a UGC folder. Can be empty
+	 * @return The UGC folders and their mod IDs
+	 */
+	FModUGCPathMap Scan(const TArray<FString>& Roots, const FString& ModIDFileName);
+
+	/**
+	 * Parses the mod ID from a folder name starting with the ID, such as "1234" or "1234_RedSpaceship"
+	 *
+	 * @return The mod ID, or the default mod ID if the name doesn't start with one
+	 */
+	static FGenericModID ParseModIDFromFolderName(const FString& FolderName);
+
+private:
+	struct FCachedRoot
+	{
+		FDateTime ModificationTime;
+		TArray<FString> FolderNames;
+	};
+
+	struct FCachedModIDFile
+	{
+		FDateTime ModificationTime;
+		FGenericModID ModID;
+	};
+
+	/**
+	 * Gets the mod ID of a UGC folder from its mod ID file if present, else from its name
+	 */
+	FGenericModID ResolveModID(const FString& FolderPath, const FString& FolderName, const FString& ModIDFileName);
+
+	FCriticalSection Lock;
+
+	/** Listing of each root at its last modification time */
+	TMap<FString, FCachedRoot> CachedRoots;
+
+	/** Mod ID read from each mod ID file at its last modification time */
+	TMap<FString, FCachedModIDFile> CachedModIDFiles;
+};
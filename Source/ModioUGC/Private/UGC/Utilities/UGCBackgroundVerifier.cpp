@@ -0,0 +1,251 @@
+/*
+ *  Copyright (C) 2025-2026 mod.io Pty Ltd. <https://mod.io>
+ *
+ *  This file is part of the mod.io ModioUGC Plugin.
+ *
+ *  Distributed under the MIT License. (See accompanying file LICENSE or
+ *   view online at <https://github.com/modio/modio-ue-modiougc/blob/main/LICENSE>)
+ *
+ */
+
+#include "UGC/Utilities/UGCBackgroundVerifier.h"
+
+#include "AssetRegistry/AssetRegistryState.h"
+#include "Async/Async.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "HAL/PlatformProcess.h"
+#include "Misc/Paths.h"
+#include "ModioUGC.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "UGC/Utilities/PakFileHelpers.h"
+#include "UGC/Utilities/UGCContentVerifier.h"
+
+// Longest the verification thread sleeps before checking whether the pass was stopped
+static constexpr double StopPollInterval = 0.1;
+
+FUGCBackgroundVerifier::FUGCBackgroundVerifier(int64 InMaxBytesPerSecond)
+	: MaxBytesPerSecond(FMath::Max<int64>(InMaxBytesPerSecond, 1))
+{}
+
+FUGCBackgroundVerifier::~FUGCBackgroundVerifier()
+{
+	if (Thread)
+	{
+		// Kill stops the runnable and waits for the thread to exit
+		Thread->Kill(true);
+		Thread.Reset();
+	}
+}
+
+bool FUGCBackgroundVerifier::StartPass(TArray<FTarget> InTargets, FOnPassComplete InOnPassComplete)
+{
+	if (bPassRunning)
+	{
+		return false;
+	}
+
+	// The thread of the previous pass has finished running, but still has to be joined
+	if (Thread)
+	{
+		Thread->WaitForCompletion();
+		Thread.Reset();
+	}
+
+	Targets = MoveTemp(InTargets);
+	OnPassComplete = MoveTemp(InOnPassComplete);
+	bStopRequested = false;
+	bPassRunning = true;
+
+	Thread.Reset(FRunnableThread::Create(this, TEXT("UGCBackgroundVerifier"), 0, TPri_Lowest));
+	if (!Thread)
+	{
+		UE_LOG(LogModioUGC, Warning, TEXT("Unable to create the background UGC verification thread"));
+		bPassRunning = false;
+		return false;
+	}
+	return true;
+}
+
+uint32 FUGCBackgroundVerifier::Run()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FUGCBackgroundVerifier::Run);
+
+	UE_LOG(LogModioUGC, Verbose, TEXT("Background verification of %d installed UGC started"), Targets.Num());
+	ThrottleWindowStart = FPlatformTime::Seconds();
+	ThrottleWindowBytes = 0;
+
+	TArray<FDamagedUGC> DamagedUGC;
+	bool bCompleted = true;
+	for (const FTarget& Target : Targets)
+	{
+		TArray<FString> DamagedFiles;
+		if (!VerifyTarget(Target, DamagedFiles))
+		{
+			bCompleted = false;
+			break;
+		}
+		if (!DamagedFiles.IsEmpty())
+		{
+			FDamagedUGC& Damaged = DamagedUGC.AddDefaulted_GetRef();
+			Damaged.UGCPath = Target.UGCPath;
+			Damaged.ModID = Target.ModID;
+			Damaged.DamagedFiles = MoveTemp(DamagedFiles);
+		}
+	}
+
+	// Keep the refreshed digests even if the pass was stopped, so the next pass and the mount path can reuse them
+	FUGCContentVerifier::Get().SaveCache();
+
+	if (bCompleted)
+	{
+		UE_LOG(LogModioUGC, Verbose, TEXT("Background verification completed, %d installed UGC damaged"),
+			   DamagedUGC.Num());
+		AsyncTask(ENamedThreads::GameThread,
+				  [OnComplete = MoveTemp(OnPassComplete), DamagedUGC = MoveTemp(DamagedUGC)]() mutable {
+					  if (OnComplete)
+					  {
+						  OnComplete(MoveTemp(DamagedUGC));
+					  }
+				  });
+	}
+	else
+	{
+		UE_LOG(LogModioUGC, Verbose, TEXT("Background verification stopped"));
+		OnPassComplete = nullptr;
+	}
+
+	Targets.Reset();
+	bPassRunning = false;
+	return 0;
+}
+
+void FUGCBackgroundVerifier::Stop()
+{
+	bStopRequested = true;
+}
+
+bool FUGCBackgroundVerifier::VerifyTarget(const FTarget& Target, TArray<FString>& OutDamagedFiles)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FUGCBackgroundVerifier::VerifyTarget);
+
+	if (!Throttle(0))
+	{
+		return false;
+	}
+
+	TArray<FString> FoundPaks;
+	FPakFileSearchVisitor PakVisitor(FoundPaks);
+	FPlatformFileManager::Get().GetPlatformFile().IterateDirectoryRecursively(*Target.UGCPath, PakVisitor);
+	FoundPaks.Sort();
+
+	TArray<FString> ContentFiles;
+	for (const FString& PakPath : FoundPaks)
+	{
+		ContentFiles.Append(FUGCContentVerifier::GetContentFilesForPak(PakPath));
+	}
+
+	FUGCContentVerifier& Verifier = FUGCContentVerifier::Get();
+	for (const FString& ContentFile : ContentFiles)
+	{
+		switch (Verifier.ReverifyFile(ContentFile, [this](int64 BytesRead) { return Throttle(BytesRead); }))
+		{
+			case EUGCContentVerificationResult::Mismatch:
+			case EUGCContentVerificationResult::ReadError:
+				OutDamagedFiles.Add(ContentFile);
+				break;
+			case EUGCContentVerificationResult::NoStoredDigest:
+				// Paks packaged without a digest can only be checked for a readable footer and index
+				if (FPaths::GetExtension(ContentFile) == TEXT("pak") && !IsPakStructureValid(ContentFile))
+				{
+					OutDamagedFiles.Add(ContentFile);
+				}
+				if (!Throttle(0))
+				{
+					return false;
+				}
+				break;
+			case EUGCContentVerificationResult::Cancelled:
+				// Also returned when the pak changed while it was hashed, e.g. while an update is installed
+				if (bStopRequested)
+				{
+					return false;
+				}
+				break;
+			default:
+				break;
+		}
+	}
+
+	// Registries inside the paks are covered by the pak digests, only loose registries are read here
+	TArray<FString> DescriptorPaths;
+	IFileManager::Get().FindFilesRecursive(DescriptorPaths, *Target.UGCPath, TEXT("*.uplugin"), true, false);
+	for (const FString& DescriptorPath : DescriptorPaths)
+	{
+		const FString AssetRegistryPath = FPaths::GetPath(DescriptorPath) / TEXT("AssetRegistry.bin");
+		const int64 AssetRegistrySize = IFileManager::Get().FileSize(*AssetRegistryPath);
+		if (AssetRegistrySize < 0)
+		{
+			continue;
+		}
+
+		FAssetRegistryState AssetRegistry;
+		if (!FAssetRegistryState::LoadFromDisk(*AssetRegistryPath, FAssetRegistryLoadOptions(), AssetRegistry))
+		{
+			UE_LOG(LogModioUGC, Error, TEXT("UGC asset registry %s failed verification: file could not be read"),
+				   *AssetRegistryPath);
+			OutDamagedFiles.Add(AssetRegistryPath);
+		}
+		if (!Throttle(AssetRegistrySize))
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+bool FUGCBackgroundVerifier::IsPakStructureValid(const FString& PakPath)
+{
+	FPakInfo PakInfo;
+	int64 PakSize = 0;
+	if (!ReadPakFooter(PakPath, PakInfo, PakSize))
+	{
+		UE_LOG(LogModioUGC, Error, TEXT("UGC pak %s failed verification: footer could not be read"), *PakPath);
+		return false;
+	}
+	if (PakInfo.IndexOffset < 0 || PakInfo.IndexSize <= 0 || PakInfo.IndexOffset + PakInfo.IndexSize > PakSize)
+	{
+		UE_LOG(LogModioUGC, Error, TEXT("UGC pak %s failed verification: index lies outside of the file"), *PakPath);
+		return false;
+	}
+	return true;
+}
+
+bool FUGCBackgroundVerifier::Throttle(int64 BytesRead)
+{
+	if (bPaused)
+	{
+		while (bPaused && !bStopRequested)
+		{
+			FPlatformProcess::Sleep(static_cast<float>(StopPollInterval));
+		}
+		// Time spent paused does not allow reading faster afterwards
+		ThrottleWindowStart = FPlatformTime::Seconds();
+		ThrottleWindowBytes = 0;
+	}
+	if (bStopRequested)
+	{
+		return false;
+	}
+
+	ThrottleWindowBytes += BytesRead;
+	const double MinElapsed = static_cast<double>(ThrottleWindowBytes) / MaxBytesPerSecond;
+	double Delay = MinElapsed - (FPlatformTime::Seconds() - ThrottleWindowStart);
+	while (Delay > 0.0 && !bStopRequested)
+	{
+		FPlatformProcess::Sleep(static_cast<float>(FMath::Min(Delay, StopPollInterval)));
+		Delay -= StopPollInterval;
+	}
+	return !bStopRequested;
+}
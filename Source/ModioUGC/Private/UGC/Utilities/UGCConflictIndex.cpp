@@ -0,0 +1,227 @@
+/*
+ *  Copyright (C) 2025-2026 mod.io Pty Ltd. <https://mod.io>
+ *
+ *  This file is part of the mod.io ModioUGC Plugin.
+ *
+ *  Distributed under the MIT License. (See accompanying file LICENSE or
+ *   view online at <https://github.com/modio/modio-ue-modiougc/blob/main/LICENSE>)
+ *
+ */
+
+#include "UGC/Utilities/UGCConflictIndex.h"
+
+#include "AssetRegistry/AssetRegistryState.h"
+#include "Hash/CityHash.h"
+#include "Misc/StringBuilder.h"
+#include "ModioUGC.h"
+#include "UGC/Utilities/UGCFileIndex.h"
+
+int32 FUGCConflictIndex::AddPackage(const FUGCPackage& Package)
+{
+	RemovePackage(Package);
+	FIndexedPackage& IndexedPackage = IndexedPackages.Add(Package);
+	const FUGCPackageState& State = Package.GetState();
+
+	if (State.LoadedAssetRegistryState.IsValid())
+	{
+		TArray<FName> PackageNames;
+		State.LoadedAssetRegistryState->GetPackageNames(PackageNames);
+		IndexedPackage.PackageNameHashes.Reserve(PackageNames.Num());
+		TStringBuilder<256> PackageNameString;
+		for (const FName PackageName : PackageNames)
+		{
+			PackageNameString.Reset();
+			PackageName.AppendString(PackageNameString);
+			const uint64 PathHash = HashPath(PackageNameString.ToView());
+			IndexedPackage.PackageNameHashes.Add(PathHash);
+
+			FPathOwners& Owners = PackageNameOwners.FindOrAdd(PathHash);
+			for (const FUGCPackage& Owner : Owners)
+			{
+				AddConflictingPath(Package, Owner, PackageNameString.ToView(), true);
+			}
+			Owners.Add(Package);
+		}
+	}
+
+	// Packages the registry already knew about before this package was mounted and that no other UGC package provides
+	// come from the base game
+	for (const FName ShadowedPackageName : State.ShadowedPackageNames)
+	{
+		const FString PackageNameString = ShadowedPackageName.ToString();
+		const FPathOwners* Owners = PackageNameOwners.Find(HashPath(PackageNameString));
+		if (!Owners || Owners->Num() <= 1)
+		{
+			AddConflictingPath(Package, FUGCPackage(), PackageNameString, true);
+		}
+	}
+
+	if (State.FileIndex.IsValid())
+	{
+		IndexedPackage.FileHashes.Reserve(State.FileIndex->Num());
+		State.FileIndex->ForEachFile([this, &Package, &IndexedPackage](FStringView FilePath) {
+			const uint64 PathHash = HashPath(FilePath);
+			IndexedPackage.FileHashes.Add(PathHash);
+
+			FPathOwners& Owners = FileOwners.FindOrAdd(PathHash);
+			for (const FUGCPackage& Owner : Owners)
+			{
+				AddConflictingPath(Package, Owner, FilePath, false);
+			}
+			Owners.Add(Package);
+			return true;
+		});
+	}
+
+	int32 NumConflicts = 0;
+	for (const TPair<TPair<FUGCPackage, FUGCPackage>, FUGCPackageConflict>& Conflict : Conflicts)
+	{
+		if (Conflict.Key.Key == Package || Conflict.Key.Value == Package)
+		{
+			++NumConflicts;
+		}
+	}
+	return NumConflicts;
+}
+
+void FUGCConflictIndex::RemovePackage(const FUGCPackage& Package)
+{
+	FIndexedPackage IndexedPackage;
+	if (!IndexedPackages.RemoveAndCopyValue(Package, IndexedPackage))
+	{
+		return;
+	}
+
+	auto RemoveOwner = [&Package](TMap<uint64, FPathOwners>& PathOwners, const TArray<uint64>& PathHashes) {
+		for (const uint64 PathHash : PathHashes)
+		{
+			if (FPathOwners* Owners = PathOwners.Find(PathHash))
+			{
+				Owners->RemoveSingle(Package);
+				if (Owners->IsEmpty())
+				{
+					PathOwners.Remove(PathHash);
+				}
+			}
+		}
+	};
+	RemoveOwner(PackageNameOwners, IndexedPackage.PackageNameHashes);
+	RemoveOwner(FileOwners, IndexedPackage.FileHashes);
+
+	for (auto It = Conflicts.CreateIterator(); It; ++It)
+	{
+		if (It->Key.Key == Package || It->Key.Value == Package)
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
+
+TArray<FUGCPackageConflict> FUGCConflictIndex::GetConflicts() const
+{
+	TArray<FUGCPackageConflict> Result;
+	Conflicts.GenerateValueArray(Result);
+	return Result;
+}
+
+TArray<FUGCPackageConflict> FUGCConflictIndex::GetConflictsForPackage(const FUGCPackage& Package) const
+{
+	TArray<FUGCPackageConflict> Result;
+	for (const TPair<TPair<FUGCPackage, FUGCPackage>, FUGCPackageConflict>& Conflict : Conflicts)
+	{
+		if (Conflict.Key.Key == Package || Conflict.Key.Value == Package)
+		{
+			Result.Add(Conflict.Value);
+		}
+	}
+	return Result;
+}
+
+void FUGCConflictIndex::LogSummary() const
+{
+	if (Conflicts.IsEmpty())
+	{
+		UE_LOG(LogModioUGC, Log, TEXT("No path conflicts between %d indexed UGC packages"), IndexedPackages.Num());
+		return;
+	}
+
+	UE_LOG(LogModioUGC, Warning, TEXT("%d path conflicts between %d indexed UGC packages:"), Conflicts.Num(),
+		   IndexedPackages.Num());
+	for (const TPair<TPair<FUGCPackage, FUGCPackage>, FUGCPackageConflict>& Conflict : Conflicts)
+	{
+		const FUGCPackageConflict& Value = Conflict.Value;
+		const FString Example = Value.ExampleConflictingPaths.IsEmpty() ? FString() : Value.ExampleConflictingPaths[0];
+		if (Value.bShadowsBaseGame)
+		{
+			UE_LOG(LogModioUGC, Warning, TEXT("  '%s' shadows %d base game packages (e.g. %s)"),
+				   *Value.Package.GetFriendlyName(), Value.NumConflictingPackages, *Example);
+		}
+		else
+		{
+			UE_LOG(LogModioUGC, Warning, TEXT("  '%s' overrides '%s': %d packages and %d files in common (e.g. %s)"),
+				   *Value.Package.GetFriendlyName(), *Value.OtherPackage.GetFriendlyName(),
+				   Value.NumConflictingPackages, Value.NumConflictingFiles, *Example);
+		}
+	}
+}
+
+SIZE_T FUGCConflictIndex::GetAllocatedSize() const
+{
+	SIZE_T AllocatedSize = PackageNameOwners.GetAllocatedSize() + FileOwners.GetAllocatedSize() +
+						   IndexedPackages.GetAllocatedSize() + Conflicts.GetAllocatedSize();
+	for (const TPair<FUGCPackage, FIndexedPackage>& IndexedPackage : IndexedPackages)
+	{
+		AllocatedSize += IndexedPackage.Value.PackageNameHashes.GetAllocatedSize() +
+						 IndexedPackage.Value.FileHashes.GetAllocatedSize();
+	}
+	return AllocatedSize;
+}
+
+uint64 FUGCConflictIndex::HashPath(FStringView Path)
+{
+	TStringBuilder<256> LowerCasePath;
+	LowerCasePath.Append(Path);
+	for (int32 Index = 0; Index < LowerCasePath.Len(); ++Index)
+	{
+		LowerCasePath.GetData()[Index] = FChar::ToLower(LowerCasePath.GetData()[Index]);
+	}
+	return CityHash64(reinterpret_cast<const char*>(LowerCasePath.GetData()), LowerCasePath.Len() * sizeof(TCHAR));
+}
+
+void FUGCConflictIndex::AddConflictingPath(const FUGCPackage& Package, const FUGCPackage& OtherPackage,
+										   FStringView Path, bool bIsPackageName)
+{
+	FUGCPackageConflict& Conflict = FindOrAddConflict(Package, OtherPackage);
+	if (bIsPackageName)
+	{
+		++Conflict.NumConflictingPackages;
+	}
+	else
+	{
+		++Conflict.NumConflictingFiles;
+	}
+	if (Conflict.ExampleConflictingPaths.Num() < MaxExampleConflictingPaths)
+	{
+		Conflict.ExampleConflictingPaths.Emplace(Path);
+	}
+}
+
+FUGCPackageConflict& FUGCConflictIndex::FindOrAddConflict(const FUGCPackage& A, const FUGCPackage& B)
+{
+	const bool bShadowsBaseGame = !B.GetAssociatedPlugin().IsValid();
+	const bool bAFirst = bShadowsBaseGame || FUGCPackage::LoadOrderPredicate(A, B);
+	const FUGCPackage& First = bAFirst ? A : B;
+	const FUGCPackage& Second = bAFirst ? B : A;
+
+	const TPair<FUGCPackage, FUGCPackage> Key(First, Second);
+	if (FUGCPackageConflict* Conflict = Conflicts.Find(Key))
+	{
+		return *Conflict;
+	}
+
+	FUGCPackageConflict& Conflict = Conflicts.Add(Key);
+	Conflict.Package = First;
+	Conflict.OtherPackage = Second;
+	Conflict.bShadowsBaseGame = bShadowsBaseGame;
+	return Conflict;
+}
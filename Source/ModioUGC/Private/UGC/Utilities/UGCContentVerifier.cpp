@@ -0,0 +1,427 @@
+/*
+ *  Copyright (C) 2025-2026 mod.io Pty Ltd. <https://mod.io>
+ *
+ *  This file is part of the mod.io ModioUGC Plugin.
+ *
+ *  Distributed under the MIT License. (See accompanying file LICENSE or
+ *   view online at <https://github.com/modio/modio-ue-modiougc/blob/main/LICENSE>)
+ *
+ */
+
+#include "UGC/Utilities/UGCContentVerifier.h"
+
+#include "Async/ParallelFor.h"
+#include "Dom/JsonObject.h"
+#include "HAL/PlatformFileManager.h"
+#include "Hash/xxhash.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "ModioUGC.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+#include <atomic>
+
+const TCHAR* FUGCContentVerifier::DigestFileExtension = TEXT(".xxh64");
+
+// Size of the reads issued while streaming a chunk through the hasher
+static constexpr int64 ReadBlockSize = 256 * 1024;
+
+static FString DigestToString(uint64 Digest)
+{
+	return FString::Printf(TEXT("%016llx"), Digest);
+}
+
+static bool DigestFromString(const FString& DigestString, uint64& OutDigest)
+{
+	const FString Trimmed = DigestString.TrimStartAndEnd();
+	if (Trimmed.Len() != 16)
+	{
+		return false;
+	}
+	for (const TCHAR Character : Trimmed)
+	{
+		if (!FChar::IsHexDigit(Character))
+		{
+			return false;
+		}
+	}
+	OutDigest = FParse::HexNumber64(*Trimmed);
+	return true;
+}
+
+FUGCContentVerifier& FUGCContentVerifier::Get()
+{
+	static FUGCContentVerifier Instance;
+	return Instance;
+}
+
+EUGCContentVerificationResult FUGCContentVerifier::VerifyFile(const FString& FilePath)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FUGCContentVerifier::VerifyFile);
+
+	const FFileStatData StatData = IPlatformFile::GetPlatformPhysical().GetStatData(*FilePath);
+	if (!StatData.bIsValid || StatData.bIsDirectory)
+	{
+		UE_LOG(LogModioUGC, Error, TEXT("Unable to verify UGC file %s: file not found"), *FilePath);
+		return EUGCContentVerificationResult::ReadError;
+	}
+
+	uint64 StoredDigest = 0;
+	if (!LoadStoredDigest(FilePath, StoredDigest))
+	{
+		UE_LOG(LogModioUGC, Verbose, TEXT("UGC file %s has no stored digest to verify against"), *FilePath);
+		return EUGCContentVerificationResult::NoStoredDigest;
+	}
+
+	uint64 Digest = 0;
+	if (!GetFileDigest(FilePath, StatData, Digest))
+	{
+		UE_LOG(LogModioUGC, Error, TEXT("Unable to verify UGC file %s: file could not be read"), *FilePath);
+		return EUGCContentVerificationResult::ReadError;
+	}
+
+	if (Digest != StoredDigest)
+	{
+		UE_LOG(LogModioUGC, Error, TEXT("UGC file %s failed verification (digest %s, expected %s)"), *FilePath,
+			   *DigestToString(Digest), *DigestToString(StoredDigest));
+		return EUGCContentVerificationResult::Mismatch;
+	}
+
+	UE_LOG(LogModioUGC, VeryVerbose, TEXT("UGC file %s verified"), *FilePath);
+	return EUGCContentVerificationResult::Verified;
+}
+
+EUGCContentVerificationResult FUGCContentVerifier::ReverifyFile(const FString& FilePath,
+																TFunctionRef<bool(int64 BytesRead)> OnBlockRead)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FUGCContentVerifier::ReverifyFile);
+
+	const FFileStatData StatData = IPlatformFile::GetPlatformPhysical().GetStatData(*FilePath);
+	if (!StatData.bIsValid || StatData.bIsDirectory)
+	{
+		return EUGCContentVerificationResult::ReadError;
+	}
+
+	uint64 StoredDigest = 0;
+	if (!LoadStoredDigest(FilePath, StoredDigest))
+	{
+		return EUGCContentVerificationResult::NoStoredDigest;
+	}
+
+	bool bCancelled = false;
+	uint64 Digest = 0;
+	const bool bDigestComputed = ComputeFileDigestSequential(
+		FilePath,
+		[&OnBlockRead, &bCancelled](int64 BytesRead) {
+			bCancelled = !OnBlockRead(BytesRead);
+			return !bCancelled;
+		},
+		Digest);
+	if (bCancelled)
+	{
+		return EUGCContentVerificationResult::Cancelled;
+	}
+	if (!bDigestComputed)
+	{
+		UE_LOG(LogModioUGC, Error, TEXT("Unable to verify UGC file %s: file could not be read"), *FilePath);
+		return EUGCContentVerificationResult::ReadError;
+	}
+
+	// The file may have been replaced while it was hashed, in which case the digest belongs to neither version
+	const FFileStatData FinalStatData = IPlatformFile::GetPlatformPhysical().GetStatData(*FilePath);
+	if (FinalStatData.FileSize != StatData.FileSize || FinalStatData.ModificationTime != StatData.ModificationTime)
+	{
+		return EUGCContentVerificationResult::Cancelled;
+	}
+	CacheDigest(FilePath, StatData, Digest);
+
+	if (Digest != StoredDigest)
+	{
+		UE_LOG(LogModioUGC, Error, TEXT("UGC file %s failed verification (digest %s, expected %s)"), *FilePath,
+			   *DigestToString(Digest), *DigestToString(StoredDigest));
+		return EUGCContentVerificationResult::Mismatch;
+	}
+	return EUGCContentVerificationResult::Verified;
+}
+
+bool FUGCContentVerifier::GetFileDigest(const FString& FilePath, uint64& OutDigest)
+{
+	const FFileStatData StatData = IPlatformFile::GetPlatformPhysical().GetStatData(*FilePath);
+	if (!StatData.bIsValid || StatData.bIsDirectory)
+	{
+		return false;
+	}
+	return GetFileDigest(FilePath, StatData, OutDigest);
+}
+
+bool FUGCContentVerifier::GetFileDigest(const FString& FilePath, const FFileStatData& StatData, uint64& OutDigest)
+{
+	{
+		FScopeLock Lock(&CacheLock);
+		LoadCache();
+		if (const FCacheEntry* Entry = Cache.Find(FilePath))
+		{
+			if (Entry->Size == StatData.FileSize && Entry->Timestamp == StatData.ModificationTime)
+			{
+				OutDigest = Entry->Digest;
+				return true;
+			}
+		}
+	}
+
+	// Hash outside of the lock so that several files can be hashed concurrently
+	uint64 Digest = 0;
+	if (!ComputeFileDigest(FilePath, Digest))
+	{
+		return false;
+	}
+
+	CacheDigest(FilePath, StatData, Digest);
+	OutDigest = Digest;
+	return true;
+}
+
+void FUGCContentVerifier::CacheDigest(const FString& FilePath, const FFileStatData& StatData, uint64 Digest)
+{
+	FScopeLock Lock(&CacheLock);
+	LoadCache();
+	FCacheEntry& Entry = Cache.FindOrAdd(FilePath);
+	Entry.Size = StatData.FileSize;
+	Entry.Timestamp = StatData.ModificationTime;
+	Entry.Digest = Digest;
+	bCacheDirty = true;
+}
+
+bool FUGCContentVerifier::ComputeFileDigest(const FString& FilePath, uint64& OutDigest)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FUGCContentVerifier::ComputeFileDigest);
+
+	IPlatformFile& PlatformFile = IPlatformFile::GetPlatformPhysical();
+	const int64 FileSize = PlatformFile.FileSize(*FilePath);
+	if (FileSize < 0)
+	{
+		return false;
+	}
+
+	const int32 NumChunks = FMath::Max(1, static_cast<int32>(FMath::DivideAndRoundUp(FileSize, ChunkSize)));
+	TArray<uint64> ChunkDigests;
+	ChunkDigests.SetNumZeroed(NumChunks);
+	std::atomic<bool> bReadFailed {false};
+
+	// Each chunk is streamed through its own handle in small blocks, so memory use stays bounded regardless of the
+	// file size
+	ParallelFor(NumChunks, [&](int32 ChunkIndex) {
+		const int64 ChunkOffset = ChunkIndex * ChunkSize;
+		int64 RemainingBytes = FMath::Min(ChunkSize, FileSize - ChunkOffset);
+
+		TUniquePtr<IFileHandle> FileHandle(PlatformFile.OpenRead(*FilePath));
+		if (!FileHandle || !FileHandle->Seek(ChunkOffset))
+		{
+			bReadFailed = true;
+			return;
+		}
+
+		TArray<uint8> Buffer;
+		Buffer.SetNumUninitialized(static_cast<int32>(FMath::Min(ReadBlockSize, FMath::Max<int64>(RemainingBytes, 1))));
+
+		FXxHash64Builder ChunkHasher;
+		while (RemainingBytes > 0 && !bReadFailed)
+		{
+			const int64 BlockSize = FMath::Min(ReadBlockSize, RemainingBytes);
+			if (!FileHandle->Read(Buffer.GetData(), BlockSize))
+			{
+				bReadFailed = true;
+				return;
+			}
+			ChunkHasher.Update(Buffer.GetData(), BlockSize);
+			RemainingBytes -= BlockSize;
+		}
+		ChunkDigests[ChunkIndex] = ChunkHasher.Finalize().Hash;
+	});
+
+	if (bReadFailed)
+	{
+		return false;
+	}
+
+	OutDigest = FXxHash64::HashBuffer(ChunkDigests.GetData(), ChunkDigests.Num() * sizeof(uint64)).Hash;
+	return true;
+}
+
+bool FUGCContentVerifier::ComputeFileDigestSequential(const FString& FilePath,
+													  TFunctionRef<bool(int64 BytesRead)> OnBlockRead,
+													  uint64& OutDigest)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FUGCContentVerifier::ComputeFileDigestSequential);
+
+	TUniquePtr<IFileHandle> FileHandle(IPlatformFile::GetPlatformPhysical().OpenRead(*FilePath));
+	if (!FileHandle)
+	{
+		return false;
+	}
+
+	const int64 FileSize = FileHandle->Size();
+	const int32 NumChunks = FMath::Max(1, static_cast<int32>(FMath::DivideAndRoundUp(FileSize, ChunkSize)));
+	TArray<uint64> ChunkDigests;
+	ChunkDigests.SetNumZeroed(NumChunks);
+
+	TArray<uint8> Buffer;
+	Buffer.SetNumUninitialized(static_cast<int32>(FMath::Min(ReadBlockSize, FMath::Max<int64>(FileSize, 1))));
+
+	// Chunks are hashed one after another, but split the same way as ComputeFileDigest so the digests match
+	for (int32 ChunkIndex = 0; ChunkIndex < NumChunks; ++ChunkIndex)
+	{
+		int64 RemainingBytes = FMath::Min(ChunkSize, FileSize - ChunkIndex * ChunkSize);
+		FXxHash64Builder ChunkHasher;
+		while (RemainingBytes > 0)
+		{
+			const int64 BlockSize = FMath::Min(ReadBlockSize, RemainingBytes);
+			if (!FileHandle->Read(Buffer.GetData(), BlockSize) || !OnBlockRead(BlockSize))
+			{
+				return false;
+			}
+			ChunkHasher.Update(Buffer.GetData(), BlockSize);
+			RemainingBytes -= BlockSize;
+		}
+		ChunkDigests[ChunkIndex] = ChunkHasher.Finalize().Hash;
+	}
+
+	OutDigest = FXxHash64::HashBuffer(ChunkDigests.GetData(), ChunkDigests.Num() * sizeof(uint64)).Hash;
+	return true;
+}
+
+TArray<FString> FUGCContentVerifier::GetContentFilesForPak(const FString& PakPath)
+{
+	TArray<FString> ContentFiles;
+	ContentFiles.Add(PakPath);
+	IPlatformFile& PlatformFile = IPlatformFile::GetPlatformPhysical();
+	for (const TCHAR* ContainerExtension : {TEXT("utoc"), TEXT("ucas")})
+	{
+		FString ContainerPath = FPaths::ChangeExtension(PakPath, ContainerExtension);
+		if (PlatformFile.FileExists(*ContainerPath))
+		{
+			ContentFiles.Add(MoveTemp(ContainerPath));
+		}
+	}
+	return ContentFiles;
+}
+
+bool FUGCContentVerifier::LoadStoredDigest(const FString& FilePath, uint64& OutDigest)
+{
+	FString DigestString;
+	if (!FFileHelper::LoadFileToString(DigestString, &IPlatformFile::GetPlatformPhysical(),
+									   *(FilePath + DigestFileExtension)))
+	{
+		return false;
+	}
+	return DigestFromString(DigestString, OutDigest);
+}
+
+bool FUGCContentVerifier::WriteStoredDigest(const FString& FilePath)
+{
+	uint64 Digest = 0;
+	if (!ComputeFileDigest(FilePath, Digest))
+	{
+		UE_LOG(LogModioUGC, Error, TEXT("Unable to compute digest for %s"), *FilePath);
+		return false;
+	}
+	return FFileHelper::SaveStringToFile(DigestToString(Digest), *(FilePath + DigestFileExtension));
+}
+
+FString FUGCContentVerifier::GetCacheFilePath()
+{
+	return FPaths::ProjectSavedDir() / TEXT("ModioUGC") / TEXT("VerifiedContent.json");
+}
+
+void FUGCContentVerifier::LoadCache()
+{
+	if (bCacheLoaded)
+	{
+		return;
+	}
+	bCacheLoaded = true;
+
+	FString CacheContent;
+	if (!FFileHelper::LoadFileToString(CacheContent, *GetCacheFilePath()))
+	{
+		return;
+	}
+
+	TSharedPtr<FJsonObject> JsonObject;
+	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(CacheContent);
+	if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
+	{
+		UE_LOG(LogModioUGC, Warning, TEXT("Discarding unreadable UGC verification cache %s"), *GetCacheFilePath());
+		return;
+	}
+
+	const TSharedPtr<FJsonObject>* FilesObject = nullptr;
+	if (!JsonObject->TryGetObjectField(TEXT("Files"), FilesObject))
+	{
+		return;
+	}
+
+	for (const TPair<FString, TSharedPtr<FJsonValue>>& File : (*FilesObject)->Values)
+	{
+		const TSharedPtr<FJsonObject>* EntryObject = nullptr;
+		if (!File.Value.IsValid() || !File.Value->TryGetObject(EntryObject))
+		{
+			continue;
+		}
+
+		FString SizeString;
+		FString TimestampString;
+		FString DigestString;
+		FCacheEntry Entry;
+		if ((*EntryObject)->TryGetStringField(TEXT("Size"), SizeString) &&
+			(*EntryObject)->TryGetStringField(TEXT("Timestamp"), TimestampString) &&
+			(*EntryObject)->TryGetStringField(TEXT("Digest"), DigestString) &&
+			DigestFromString(DigestString, Entry.Digest))
+		{
+			LexFromString(Entry.Size, *SizeString);
+			int64 Ticks = 0;
+			LexFromString(Ticks, *TimestampString);
+			Entry.Timestamp = FDateTime(Ticks);
+			Cache.Add(File.Key, Entry);
+		}
+	}
+
+	UE_LOG(LogModioUGC, Verbose, TEXT("Loaded %d entries from the UGC verification cache"), Cache.Num());
+}
+
+void FUGCContentVerifier::SaveCache()
+{
+	FString CacheContent;
+	{
+		FScopeLock Lock(&CacheLock);
+		if (!bCacheDirty)
+		{
+			return;
+		}
+
+		TSharedRef<FJsonObject> FilesObject = MakeShared<FJsonObject>();
+		for (const TPair<FString, FCacheEntry>& File : Cache)
+		{
+			TSharedRef<FJsonObject> EntryObject = MakeShared<FJsonObject>();
+			EntryObject->SetStringField(TEXT("Size"), LexToString(File.Value.Size));
+			EntryObject->SetStringField(TEXT("Timestamp"), LexToString(File.Value.Timestamp.GetTicks()));
+			EntryObject->SetStringField(TEXT("Digest"), DigestToString(File.Value.Digest));
+			FilesObject->SetObjectField(File.Key, EntryObject);
+		}
+
+		TSharedRef<FJsonObject> JsonObject = MakeShared<FJsonObject>();
+		JsonObject->SetObjectField(TEXT("Files"), FilesObject);
+
+		TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&CacheContent);
+		FJsonSerializer::Serialize(JsonObject, Writer);
+		bCacheDirty = false;
+	}
+
+	if (!FFileHelper::SaveStringToFile(CacheContent, *GetCacheFilePath()))
+	{
+		UE_LOG(LogModioUGC, Warning, TEXT("Failed to write UGC verification cache %s"), *GetCacheFilePath());
+	}
+}
@@ -0,0 +1,281 @@
+/*
+ *  Copyright (C) 2025-2026 mod.io Pty Ltd. <https://mod.io>
+ *
+ *  This file is part of the mod.io ModioUGC Plugin.
+ *
+ *  Distributed under the MIT License. (See accompanying file LICENSE or
+ *   view online at <https://github.com/modio/modio-ue-modiougc/blob/main/LICENSE>)
+ *
+ */
+
+#include "UGC/Utilities/UGCDependencyGraph.h"
+
+#include "Algo/Reverse.h"
+
+int32 FUGCDependencyGraph::AddPackage(const FString& PluginName, const FString& DescriptorPath,
+									  TArray<FString> Dependencies)
+{
+	const int32 PackageIndex = Packages.Num();
+	FPackage& Package = Packages.AddDefaulted_GetRef();
+	Package.PluginName = PluginName;
+	Package.DescriptorPath = DescriptorPath;
+	Package.Dependencies = MoveTemp(Dependencies);
+	PluginNameToPackageIndex.Add(PluginName, PackageIndex);
+	return PackageIndex;
+}
+
+void FUGCDependencyGraph::Resolve(TFunctionRef<bool(const FString& PluginName)> IsAvailableOutsideGraph)
+{
+	Waves.Reset();
+	Issues.Reset();
+
+	TArray<bool> Blocked;
+	Blocked.SetNumZeroed(Packages.Num());
+	TArray<int32> NumUnorderedDependencies;
+	NumUnorderedDependencies.SetNumZeroed(Packages.Num());
+
+	for (FPackage& Package : Packages)
+	{
+		Package.GraphDependencies.Reset();
+		Package.Dependents.Reset();
+	}
+
+	for (int32 PackageIndex = 0; PackageIndex < Packages.Num(); ++PackageIndex)
+	{
+		TArray<FString> MissingDependencies;
+		for (const FString& Dependency : Packages[PackageIndex].Dependencies)
+		{
+			if (const int32* DependencyIndex = PluginNameToPackageIndex.Find(Dependency))
+			{
+				if (!Packages[PackageIndex].GraphDependencies.Contains(*DependencyIndex))
+				{
+					Packages[PackageIndex].GraphDependencies.Add(*DependencyIndex);
+					Packages[*DependencyIndex].Dependents.Add(PackageIndex);
+				}
+			}
+			else if (!IsAvailableOutsideGraph(Dependency))
+			{
+				MissingDependencies.Add(Dependency);
+			}
+		}
+		NumUnorderedDependencies[PackageIndex] = Packages[PackageIndex].GraphDependencies.Num();
+
+		if (!MissingDependencies.IsEmpty())
+		{
+			Blocked[PackageIndex] = true;
+			AddIssue(PackageIndex, EUGCPackageDependencyIssueType::MissingDependency, MoveTemp(MissingDependencies));
+		}
+	}
+
+	// Kahn's algorithm, one level at a time so that each level forms a wave of independent packages
+	TArray<bool> Ordered;
+	Ordered.SetNumZeroed(Packages.Num());
+	TArray<int32> CurrentLevel;
+	for (int32 PackageIndex = 0; PackageIndex < Packages.Num(); ++PackageIndex)
+	{
+		if (NumUnorderedDependencies[PackageIndex] == 0)
+		{
+			CurrentLevel.Add(PackageIndex);
+		}
+	}
+
+	while (!CurrentLevel.IsEmpty())
+	{
+		TArray<int32> Wave;
+		TArray<int32> NextLevel;
+		for (const int32 PackageIndex : CurrentLevel)
+		{
+			Ordered[PackageIndex] = true;
+			if (!Blocked[PackageIndex])
+			{
+				TArray<FString> BlockedDependencies;
+				for (const int32 DependencyIndex : Packages[PackageIndex].GraphDependencies)
+				{
+					if (Blocked[DependencyIndex])
+					{
+						BlockedDependencies.Add(Packages[DependencyIndex].PluginName);
+					}
+				}
+				if (BlockedDependencies.IsEmpty())
+				{
+					Wave.Add(PackageIndex);
+				}
+				else
+				{
+					Blocked[PackageIndex] = true;
+					AddIssue(PackageIndex, EUGCPackageDependencyIssueType::BlockedByDependency,
+							 MoveTemp(BlockedDependencies));
+				}
+			}
+
+			for (const int32 DependentIndex : Packages[PackageIndex].Dependents)
+			{
+				if (--NumUnorderedDependencies[DependentIndex] == 0)
+				{
+					NextLevel.Add(DependentIndex);
+				}
+			}
+		}
+
+		if (!Wave.IsEmpty())
+		{
+			Waves.Add(MoveTemp(Wave));
+		}
+		CurrentLevel = MoveTemp(NextLevel);
+	}
+
+	// Packages that were never ordered are either in a cycle or depend on one
+	TArray<int32> UnorderedPackages;
+	for (int32 PackageIndex = 0; PackageIndex < Packages.Num(); ++PackageIndex)
+	{
+		if (!Ordered[PackageIndex])
+		{
+			UnorderedPackages.Add(PackageIndex);
+		}
+	}
+	if (UnorderedPackages.IsEmpty())
+	{
+		return;
+	}
+
+	TArray<bool> InCycle;
+	InCycle.SetNumZeroed(Packages.Num());
+	for (const TArray<int32>& Cycle : FindCycles(UnorderedPackages))
+	{
+		TArray<FString> CyclePluginNames;
+		for (const int32 PackageIndex : Cycle)
+		{
+			CyclePluginNames.Add(Packages[PackageIndex].PluginName);
+			InCycle[PackageIndex] = true;
+		}
+		for (const int32 PackageIndex : Cycle)
+		{
+			if (!Blocked[PackageIndex])
+			{
+				AddIssue(PackageIndex, EUGCPackageDependencyIssueType::DependencyCycle, CyclePluginNames);
+			}
+		}
+	}
+
+	for (const int32 PackageIndex : UnorderedPackages)
+	{
+		if (Blocked[PackageIndex] || InCycle[PackageIndex])
+		{
+			continue;
+		}
+
+		TArray<FString> BlockedDependencies;
+		for (const int32 DependencyIndex : Packages[PackageIndex].GraphDependencies)
+		{
+			if (!Ordered[DependencyIndex] || Blocked[DependencyIndex])
+			{
+				BlockedDependencies.Add(Packages[DependencyIndex].PluginName);
+			}
+		}
+		AddIssue(PackageIndex, EUGCPackageDependencyIssueType::BlockedByDependency, MoveTemp(BlockedDependencies));
+	}
+}
+
+void FUGCDependencyGraph::AddIssue(int32 PackageIndex, EUGCPackageDependencyIssueType IssueType,
+								   TArray<FString> Dependencies)
+{
+	FUGCPackageDependencyIssue& Issue = Issues.AddDefaulted_GetRef();
+	Issue.PluginName = Packages[PackageIndex].PluginName;
+	Issue.DescriptorPath = Packages[PackageIndex].DescriptorPath;
+	Issue.IssueType = IssueType;
+	Issue.Dependencies = MoveTemp(Dependencies);
+}
+
+TArray<TArray<int32>> FUGCDependencyGraph::FindCycles(const TArray<int32>& UnorderedPackages) const
+{
+	TArray<bool> InSubgraph;
+	InSubgraph.SetNumZeroed(Packages.Num());
+	for (const int32 PackageIndex : UnorderedPackages)
+	{
+		InSubgraph[PackageIndex] = true;
+	}
+
+	TArray<int32> VisitIndex;
+	TArray<int32> LowLink;
+	TArray<bool> OnStack;
+	VisitIndex.Init(INDEX_NONE, Packages.Num());
+	LowLink.Init(INDEX_NONE, Packages.Num());
+	OnStack.SetNumZeroed(Packages.Num());
+	TArray<int32> ComponentStack;
+	int32 NextVisitIndex = 0;
+
+	// Iterative depth first search, so that long dependency chains cannot overflow the call stack
+	struct FFrame
+	{
+		int32 PackageIndex;
+		int32 NextDependency;
+	};
+	TArray<FFrame> CallStack;
+	TArray<TArray<int32>> Cycles;
+
+	auto Visit = [&](int32 PackageIndex) {
+		VisitIndex[PackageIndex] = LowLink[PackageIndex] = NextVisitIndex++;
+		ComponentStack.Push(PackageIndex);
+		OnStack[PackageIndex] = true;
+		CallStack.Add({PackageIndex, 0});
+	};
+
+	for (const int32 RootIndex : UnorderedPackages)
+	{
+		if (VisitIndex[RootIndex] != INDEX_NONE)
+		{
+			continue;
+		}
+
+		Visit(RootIndex);
+		while (!CallStack.IsEmpty())
+		{
+			const int32 PackageIndex = CallStack.Last().PackageIndex;
+			const TArray<int32>& Dependencies = Packages[PackageIndex].GraphDependencies;
+			if (CallStack.Last().NextDependency < Dependencies.Num())
+			{
+				const int32 DependencyIndex = Dependencies[CallStack.Last().NextDependency++];
+				if (!InSubgraph[DependencyIndex])
+				{
+					continue;
+				}
+				if (VisitIndex[DependencyIndex] == INDEX_NONE)
+				{
+					Visit(DependencyIndex);
+				}
+				else if (OnStack[DependencyIndex])
+				{
+					LowLink[PackageIndex] = FMath::Min(LowLink[PackageIndex], VisitIndex[DependencyIndex]);
+				}
+				continue;
+			}
+
+			if (LowLink[PackageIndex] == VisitIndex[PackageIndex])
+			{
+				TArray<int32> Component;
+				int32 ComponentIndex = INDEX_NONE;
+				do
+				{
+					ComponentIndex = ComponentStack.Pop();
+					OnStack[ComponentIndex] = false;
+					Component.Add(ComponentIndex);
+				} while (ComponentIndex != PackageIndex);
+
+				if (Component.Num() > 1 || Dependencies.Contains(PackageIndex))
+				{
+					Algo::Reverse(Component);
+					Cycles.Add(MoveTemp(Component));
+				}
+			}
+
+			CallStack.Pop();
+			if (!CallStack.IsEmpty())
+			{
+				const int32 ParentIndex = CallStack.Last().PackageIndex;
+				LowLink[ParentIndex] = FMath::Min(LowLink[ParentIndex], LowLink[PackageIndex]);
+			}
+		}
+	}
+
+	return Cycles;
+}
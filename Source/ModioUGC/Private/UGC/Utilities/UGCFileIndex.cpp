@@ -0,0 +1,249 @@
+/*
+ *  Copyright (C) 2025-2026 mod.io Pty Ltd. <https://mod.io>
+ *
+ *  This file is part of the mod.io ModioUGC Plugin.
+ *
+ *  Distributed under the MIT License. (See accompanying file LICENSE or
+ *   view online at <https://github.com/modio/modio-ue-modiougc/blob/main/LICENSE>)
+ *
+ */
+
+#include "UGC/Utilities/UGCFileIndex.h"
+
+#include "Containers/StringConv.h"
+
+namespace UGCFileIndex
+{
+	uint8 FoldCase(uint8 Char)
+	{
+		return (Char >= 'A' && Char <= 'Z') ? Char + ('a' - 'A') : Char;
+	}
+
+	/**
+	 * Compares two UTF-8 paths byte by byte ignoring ASCII case. Byte order of UTF-8 matches code point order
+	 */
+	int32 ComparePaths(TArrayView<const uint8> A, TArrayView<const uint8> B)
+	{
+		const int32 CommonLength = FMath::Min(A.Num(), B.Num());
+		for (int32 Index = 0; Index < CommonLength; ++Index)
+		{
+			const uint8 FoldedA = FoldCase(A[Index]);
+			const uint8 FoldedB = FoldCase(B[Index]);
+			if (FoldedA != FoldedB)
+			{
+				return FoldedA < FoldedB ? -1 : 1;
+			}
+		}
+		return A.Num() == B.Num() ? 0 : (A.Num() < B.Num() ? -1 : 1);
+	}
+
+	bool StartsWithPath(TArrayView<const uint8> Path, TArrayView<const uint8> Prefix)
+	{
+		return Path.Num() >= Prefix.Num() && ComparePaths(Path.Left(Prefix.Num()), Prefix) == 0;
+	}
+
+	void WriteVarInt(TArray<uint8>& Data, uint32 Value)
+	{
+		while (Value >= 0x80)
+		{
+			Data.Add(static_cast<uint8>(Value | 0x80));
+			Value >>= 7;
+		}
+		Data.Add(static_cast<uint8>(Value));
+	}
+
+	uint32 ReadVarInt(const uint8*& Cursor)
+	{
+		uint32 Value = 0;
+		int32 Shift = 0;
+		uint8 Byte = 0;
+		do
+		{
+			Byte = *Cursor++;
+			Value |= static_cast<uint32>(Byte & 0x7F) << Shift;
+			Shift += 7;
+		} while (Byte & 0x80);
+		return Value;
+	}
+
+	TArray<uint8> ToUtf8(FStringView Path)
+	{
+		FTCHARToUTF8 Converted(Path.GetData(), Path.Len());
+		return TArray<uint8>(reinterpret_cast<const uint8*>(Converted.Get()), Converted.Length());
+	}
+
+	FString FromUtf8(TArrayView<const uint8> Path)
+	{
+		FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(Path.GetData()), Path.Num());
+		return FString(Converted.Length(), Converted.Get());
+	}
+} // namespace UGCFileIndex
+
+FUGCFileIndex::FUGCFileIndex(const TArray<FString>& FilePaths)
+{
+	using namespace UGCFileIndex;
+
+	TArray<TArray<uint8>> EncodedPaths;
+	EncodedPaths.Reserve(FilePaths.Num());
+	for (const FString& FilePath : FilePaths)
+	{
+		EncodedPaths.Add(ToUtf8(FilePath));
+	}
+	EncodedPaths.Sort([](const TArray<uint8>& A, const TArray<uint8>& B) { return ComparePaths(A, B) < 0; });
+
+	const TArray<uint8>* PreviousPath = nullptr;
+	for (const TArray<uint8>& Path : EncodedPaths)
+	{
+		if (PreviousPath && ComparePaths(*PreviousPath, Path) == 0)
+		{
+			continue;
+		}
+
+		int32 SharedLength = 0;
+		if (NumFiles % RestartInterval == 0)
+		{
+			RestartOffsets.Add(Data.Num());
+		}
+		else
+		{
+			const int32 MaxSharedLength = FMath::Min(PreviousPath->Num(), Path.Num());
+			while (SharedLength < MaxSharedLength && (*PreviousPath)[SharedLength] == Path[SharedLength])
+			{
+				++SharedLength;
+			}
+		}
+
+		WriteVarInt(Data, SharedLength);
+		WriteVarInt(Data, Path.Num() - SharedLength);
+		Data.Append(Path.GetData() + SharedLength, Path.Num() - SharedLength);
+
+		PreviousPath = &Path;
+		++NumFiles;
+	}
+
+	Data.Shrink();
+	RestartOffsets.Shrink();
+}
+
+bool FUGCFileIndex::Contains(FStringView FilePath) const
+{
+	if (NumFiles == 0)
+	{
+		return false;
+	}
+
+	const TArray<uint8> Key = UGCFileIndex::ToUtf8(FilePath);
+	bool bFound = false;
+	VisitFromRestart(FindRestartForKey(Key), [&Key, &bFound](TArrayView<const uint8> Path) {
+		const int32 Comparison = UGCFileIndex::ComparePaths(Path, Key);
+		bFound = Comparison == 0;
+		return Comparison < 0;
+	});
+	return bFound;
+}
+
+void FUGCFileIndex::FindMatches(FStringView Wildcard, TArray<FString>& OutFilePaths) const
+{
+	if (NumFiles == 0)
+	{
+		return;
+	}
+
+	int32 LiteralPrefixLength = 0;
+	while (LiteralPrefixLength < Wildcard.Len() && Wildcard[LiteralPrefixLength] != TEXT('*') &&
+		   Wildcard[LiteralPrefixLength] != TEXT('?'))
+	{
+		++LiteralPrefixLength;
+	}
+
+	const TArray<uint8> Prefix = UGCFileIndex::ToUtf8(Wildcard.Left(LiteralPrefixLength));
+	const FString WildcardString(Wildcard);
+	VisitFromRestart(FindRestartForKey(Prefix), [&](TArrayView<const uint8> Path) {
+		if (UGCFileIndex::ComparePaths(Path, Prefix) < 0)
+		{
+			return true;
+		}
+		if (!UGCFileIndex::StartsWithPath(Path, Prefix))
+		{
+			return false;
+		}
+
+		FString FilePath = UGCFileIndex::FromUtf8(Path);
+		if (FilePath.MatchesWildcard(WildcardString, ESearchCase::IgnoreCase))
+		{
+			OutFilePaths.Add(MoveTemp(FilePath));
+		}
+		return true;
+	});
+}
+
+void FUGCFileIndex::ForEachFile(TFunctionRef<bool(FStringView FilePath)> Visitor) const
+{
+	if (NumFiles == 0)
+	{
+		return;
+	}
+
+	VisitFromRestart(0, [&Visitor](TArrayView<const uint8> Path) { return Visitor(UGCFileIndex::FromUtf8(Path)); });
+}
+
+SIZE_T FUGCFileIndex::GetAllocatedSize() const
+{
+	return Data.GetAllocatedSize() + RestartOffsets.GetAllocatedSize();
+}
+
+void FUGCFileIndex::VisitFromRestart(int32 RestartIndex,
+									 TFunctionRef<bool(TArrayView<const uint8> Path)> Visitor) const
+{
+	// Entries only ever grow the buffer, so the shared prefix of the previous entry is still in place
+	TArray<uint8> CurrentPath;
+	const uint8* Cursor = Data.GetData() + RestartOffsets[RestartIndex];
+	const uint8* End = Data.GetData() + Data.Num();
+	while (Cursor < End)
+	{
+		const uint32 SharedLength = UGCFileIndex::ReadVarInt(Cursor);
+		const uint32 SuffixLength = UGCFileIndex::ReadVarInt(Cursor);
+		const int32 PathLength = SharedLength + SuffixLength;
+		if (CurrentPath.Num() < PathLength)
+		{
+			CurrentPath.SetNumUninitialized(PathLength);
+		}
+		FMemory::Memcpy(CurrentPath.GetData() + SharedLength, Cursor, SuffixLength);
+		Cursor += SuffixLength;
+
+		if (!Visitor(MakeArrayView(CurrentPath.GetData(), PathLength)))
+		{
+			return;
+		}
+	}
+}
+
+int32 FUGCFileIndex::FindRestartForKey(TArrayView<const uint8> Key) const
+{
+	int32 Low = 0;
+	int32 High = RestartOffsets.Num() - 1;
+	int32 Result = 0;
+	while (Low <= High)
+	{
+		const int32 Middle = Low + (High - Low) / 2;
+		if (UGCFileIndex::ComparePaths(GetRestartPath(Middle), Key) <= 0)
+		{
+			Result = Middle;
+			Low = Middle + 1;
+		}
+		else
+		{
+			High = Middle - 1;
+		}
+	}
+	return Result;
+}
+
+TArrayView<const uint8> FUGCFileIndex::GetRestartPath(int32 RestartIndex) const
+{
+	const uint8* Cursor = Data.GetData() + RestartOffsets[RestartIndex];
+	// Restart entries share nothing with the previous entry, so only the suffix length is relevant
+	UGCFileIndex::ReadVarInt(Cursor);
+	const uint32 PathLength = UGCFileIndex::ReadVarInt(Cursor);
+	return MakeArrayView(Cursor, PathLength);
+}
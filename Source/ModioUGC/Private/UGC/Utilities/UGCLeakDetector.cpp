@@ -0,0 +1,132 @@
+/*
+ *  Copyright (C) 2025-2026 mod.io Pty Ltd. <https://mod.io>
+ *
+ *  This file is part of the mod.io ModioUGC Plugin.
+ *
+ *  Distributed under the MIT License. (See accompanying file LICENSE or
+ *   view online at <https://github.com/modio/modio-ue-modiougc/blob/main/LICENSE>)
+ *
+ */
+
+#include "UGC/Utilities/UGCLeakDetector.h"
+
+#include "Algo/StableSort.h"
+#include "Misc/StringBuilder.h"
+#include "ModioUGC.h"
+#include "ModioUGCSettings.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "UGC/UGCStats.h"
+#include "UObject/Package.h"
+#include "UObject/UObjectHash.h"
+#include "UObject/UObjectIterator.h"
+#if !UE_BUILD_SHIPPING
+	#include "UObject/ReferenceChainSearch.h"
+#endif
+
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Leaked UGC Objects"), STAT_UGCLeakedObjects, STATGROUP_ModioUGC);
+
+FUGCLeakDetector& FUGCLeakDetector::Get()
+{
+	static FUGCLeakDetector Instance;
+	return Instance;
+}
+
+bool FUGCLeakDetector::ShouldVerify()
+{
+	const UModioUGCSettings* UGCSettings = GetDefault<UModioUGCSettings>();
+	if (!UGCSettings || !UGCSettings->bDetectUGCLeaksAfterUnload)
+	{
+		return false;
+	}
+
+	const double Now = FPlatformTime::Seconds();
+	if (bHasVerified && Now - LastVerifyTime < UGCSettings->UGCLeakDetectionInterval)
+	{
+		UE_LOG(LogModioUGC, Verbose, TEXT("Skipping UGC leak detection, last pass was %.1f seconds ago"),
+			   Now - LastVerifyTime);
+		return false;
+	}
+
+	bHasVerified = true;
+	LastVerifyTime = Now;
+	return true;
+}
+
+int32 FUGCLeakDetector::Verify(const FString& FriendlyName, FName MountRoot, const TArray<FName>& PackageNames)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FUGCLeakDetector::Verify);
+
+	TSet<UPackage*> SurvivingPackages;
+	for (const FName PackageName : PackageNames)
+	{
+		if (UPackage* Package = FindObjectFast<UPackage>(nullptr, PackageName))
+		{
+			SurvivingPackages.Add(Package);
+		}
+	}
+
+	// Packages created at runtime under the mount root are not listed in the registry
+	TStringBuilder<256> MountRootPrefix;
+	MountRootPrefix << MountRoot << TEXT('/');
+	TStringBuilder<256> PackageNameString;
+	for (TObjectIterator<UPackage> It; It; ++It)
+	{
+		PackageNameString.Reset();
+		It->GetFName().AppendString(PackageNameString);
+		if (PackageNameString.ToView().StartsWith(MountRootPrefix.ToView(), ESearchCase::IgnoreCase))
+		{
+			SurvivingPackages.Add(*It);
+		}
+	}
+
+	if (SurvivingPackages.IsEmpty())
+	{
+		UE_LOG(LogModioUGC, Log, TEXT("No objects of UGC `%s` survived unload"), *FriendlyName);
+		return 0;
+	}
+
+	TArray<UObject*> SurvivingObjects;
+	for (UPackage* Package : SurvivingPackages)
+	{
+		SurvivingObjects.Add(Package);
+		ForEachObjectWithPackage(
+			Package,
+			[&SurvivingObjects](UObject* Object) {
+				SurvivingObjects.Add(Object);
+				return true;
+			},
+			true);
+	}
+	INC_DWORD_STAT_BY(STAT_UGCLeakedObjects, SurvivingObjects.Num());
+
+	UE_LOG(LogModioUGC, Warning, TEXT("%d objects in %d packages of UGC `%s` survived unload"), SurvivingObjects.Num(),
+		   SurvivingPackages.Num(), *FriendlyName);
+
+	// Assets are what gameplay code usually holds on to, and their chain explains most of their subobjects too
+	Algo::StableSortBy(SurvivingObjects, [](const UObject* Object) { return Object->IsAsset() ? 0 : 1; });
+
+	const UModioUGCSettings* UGCSettings = GetDefault<UModioUGCSettings>();
+	const int32 MaxReferenceChains = UGCSettings ? FMath::Max(UGCSettings->UGCLeakMaxReferenceChains, 0) : 0;
+	const int32 NumListedObjects = FMath::Min(SurvivingObjects.Num(), MaxListedObjects);
+	for (int32 ObjectIndex = 0; ObjectIndex < NumListedObjects; ++ObjectIndex)
+	{
+		UObject* Object = SurvivingObjects[ObjectIndex];
+		if (ObjectIndex >= MaxReferenceChains)
+		{
+			UE_LOG(LogModioUGC, Warning, TEXT("  Leaked UGC object %s"), *Object->GetFullName());
+			continue;
+		}
+
+		UE_LOG(LogModioUGC, Warning, TEXT("  Leaked UGC object %s, referenced by:"), *Object->GetFullName());
+#if !UE_BUILD_SHIPPING
+		FReferenceChainSearch ReferenceChainSearch(
+			Object, EReferenceChainSearchMode::Shortest | EReferenceChainSearchMode::PrintResults);
+#endif
+	}
+	if (NumListedObjects < SurvivingObjects.Num())
+	{
+		UE_LOG(LogModioUGC, Warning, TEXT("  ... and %d more"), SurvivingObjects.Num() - NumListedObjects);
+	}
+
+	return SurvivingObjects.Num();
+}
@@ -0,0 +1,49 @@
+/*
+ *  Copyright (C) 2025-2026 mod.io Pty Ltd. <https://mod.io>
+ *
+ *  This file is part of the mod.io ModioUGC Plugin.
+ *
+ *  Distributed under the MIT License. (See accompanying file LICENSE or
+ *   view online at <https://github.com/modio/modio-ue-modiougc/blob/main/LICENSE>)
+ *
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Verifies that the objects of a UGC package are gone after it was unloaded and garbage collected.
+ *
+ * Surviving objects are logged as warnings, along with the reference chains keeping the first few of them alive in
+ * non-shipping builds. Searching reference chains walks the whole object graph, so passes are opt-in and throttled.
+ */
+class FUGCLeakDetector
+{
+public:
+	/**
+	 * Maximum number of surviving objects listed per pass
+	 */
+	static constexpr int32 MaxListedObjects = 32;
+
+	static FUGCLeakDetector& Get();
+
+	/**
+	 * Whether the next unload should be verified. Consumes the throttle interval when it returns true
+	 */
+	bool ShouldVerify();
+
+	/**
+	 * Finds the objects of an unloaded UGC package that survived garbage collection and reports them
+	 *
+	 * @param FriendlyName Name of the UGC package, for reporting
+	 * @param MountRoot Mount root of the package (e.g. "/RedSpaceship"). Any package under it belongs to the package
+	 * @param PackageNames Package names from the asset registry of the package, which may be outside the mount root
+	 * @return Number of surviving objects
+	 */
+	int32 Verify(const FString& FriendlyName, FName MountRoot, const TArray<FName>& PackageNames);
+
+private:
+	double LastVerifyTime = 0.0;
+	bool bHasVerified = false;
+};
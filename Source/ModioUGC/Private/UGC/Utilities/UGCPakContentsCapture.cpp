@@ -0,0 +1,116 @@
+/*
+ *  Copyright (C) 2025-2026 mod.io Pty Ltd. <https://mod.io>
+ *
+ *  This file is part of the mod.io ModioUGC Plugin.
+ *
+ *  Distributed under the MIT License. (See accompanying file LICENSE or
+ *   view online at <https://github.com/modio/modio-ue-modiougc/blob/main/LICENSE>)
+ *
+ */
+
+#include "UGC/Utilities/UGCPakContentsCapture.h"
+
+#include "IPlatformFilePak.h"
+#include "Misc/CoreDelegates.h"
+#include "Misc/EngineVersionComparison.h"
+#include "Misc/Paths.h"
+#include "ModioUGC.h"
+
+namespace UGCPakContentsCapture
+{
+	FString GetCaptureKey(const FString& PakPath)
+	{
+		FString CaptureKey = PakPath;
+		FPaths::NormalizeFilename(CaptureKey);
+		return CaptureKey;
+	}
+
+	class FPakFileCollector final : public IPlatformFile::FDirectoryVisitor
+	{
+	public:
+		TArray<FString> Files;
+
+		virtual bool Visit(const TCHAR* FilenameOrDirectory, bool bIsDirectory) override
+		{
+			if (!bIsDirectory)
+			{
+				Files.Emplace(FilenameOrDirectory);
+			}
+			return true;
+		}
+	};
+} // namespace UGCPakContentsCapture
+
+FUGCPakContentsCapture& FUGCPakContentsCapture::Get()
+{
+	static FUGCPakContentsCapture Instance;
+	return Instance;
+}
+
+void FUGCPakContentsCapture::BeginCapture(const TArray<FString>& PakPaths)
+{
+	FScopeLock ScopeLock(&Lock);
+	for (const FString& PakPath : PakPaths)
+	{
+		CapturedFiles.Add(UGCPakContentsCapture::GetCaptureKey(PakPath));
+	}
+
+	// Bound once for the lifetime of the process
+	if (!PakFileMountedHandle.IsValid())
+	{
+		PakFileMountedHandle =
+#if UE_VERSION_OLDER_THAN(5, 3, 0)
+			FCoreDelegates::OnPakFileMounted2
+#else
+			FCoreDelegates::GetOnPakFileMounted2()
+#endif
+				.AddRaw(this, &FUGCPakContentsCapture::OnPakFileMounted);
+	}
+}
+
+TArray<FString> FUGCPakContentsCapture::EndCapture(const TArray<FString>& PakPaths)
+{
+	TArray<FString> Files;
+	FScopeLock ScopeLock(&Lock);
+	for (const FString& PakPath : PakPaths)
+	{
+		TArray<FString> PakFiles;
+		if (CapturedFiles.RemoveAndCopyValue(UGCPakContentsCapture::GetCaptureKey(PakPath), PakFiles))
+		{
+			Files.Append(MoveTemp(PakFiles));
+		}
+	}
+	return Files;
+}
+
+void FUGCPakContentsCapture::OnPakFileMounted(const IPakFile& PakFile)
+{
+	const FString CaptureKey = UGCPakContentsCapture::GetCaptureKey(PakFile.PakGetPakFilename());
+	{
+		FScopeLock ScopeLock(&Lock);
+		if (!CapturedFiles.Contains(CaptureKey))
+		{
+			return;
+		}
+	}
+
+	// Visit outside the lock so paks mounted in parallel do not serialize on each other
+	UGCPakContentsCapture::FPakFileCollector Collector;
+	PakFile.PakVisitPrunedFilenames(Collector);
+
+	UE_LOG(LogModioUGC, VeryVerbose, TEXT("Pakfile %s mounted with %d files"), *PakFile.PakGetPakFilename(),
+		   Collector.Files.Num());
+	if (UE_LOG_ACTIVE(LogModioUGC, VeryVerbose))
+	{
+		for (const FString& File : Collector.Files)
+		{
+			UE_LOG(LogModioUGC, VeryVerbose, TEXT("Pakfile %s : %s"), *PakFile.PakGetPakFilename(), *File);
+		}
+	}
+
+	FScopeLock ScopeLock(&Lock);
+	if (TArray<FString>* Files = CapturedFiles.Find(CaptureKey))
+	{
+		*Files = MoveTemp(Collector.Files);
+	}
+}
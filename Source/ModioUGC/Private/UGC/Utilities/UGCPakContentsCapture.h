@@ -0,0 +1,48 @@
+/*
+ *  Copyright (C) 2025-2026 mod.io Pty Ltd. <https://mod.io>
+ *
+ *  This file is part of the mod.io ModioUGC Plugin.
+ *
+ *  Distributed under the MIT License. (See accompanying file LICENSE or
+ *   view online at <https://github.com/modio/modio-ue-modiougc/blob/main/LICENSE>)
+ *
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class IPakFile;
+
+/**
+ * Captures the file lists of UGC pak files as they are mounted, so the file index of a UGC package can be built from
+ * the pak directory index once instead of walking it on every query.
+ *
+ * Only paks registered with BeginCapture are visited, other paks mounted by the engine are ignored. The engine may
+ * mount its own paks from other threads, so captures are guarded by a lock.
+ */
+class FUGCPakContentsCapture
+{
+public:
+	static FUGCPakContentsCapture& Get();
+
+	/**
+	 * Starts capturing the file lists of the given paks when they are mounted
+	 */
+	void BeginCapture(const TArray<FString>& PakPaths);
+
+	/**
+	 * Stops capturing the given paks and returns the files captured for them
+	 */
+	TArray<FString> EndCapture(const TArray<FString>& PakPaths);
+
+private:
+	void OnPakFileMounted(const IPakFile& PakFile);
+
+	FCriticalSection Lock;
+
+	/** Captured files keyed by normalized pak path. Paks being captured have an entry even before they are mounted */
+	TMap<FString, TArray<FString>> CapturedFiles;
+
+	FDelegateHandle PakFileMountedHandle;
+};
@@ -0,0 +1,126 @@
+/*
+ *  Copyright (C) 2025-2026 mod.io Pty Ltd. <https://mod.io>
+ *
+ *  This file is part of the mod.io ModioUGC Plugin.
+ *
+ *  Distributed under the MIT License. (See accompanying file LICENSE or
+ *   view online at <https://github.com/modio/modio-ue-modiougc/blob/main/LICENSE>)
+ *
+ */
+
+#include "UGC/Utilities/UGCPakPrefetcher.h"
+
+#include "Async/AsyncFileHandle.h"
+#include "HAL/PlatformFileManager.h"
+#include "Interfaces/IPluginManager.h"
+#include "Misc/Paths.h"
+#include "ModioUGC.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "UGC/Utilities/PakFileHelpers.h"
+
+#if PLATFORM_LINUX
+	#include <fcntl.h>
+	#include <unistd.h>
+#endif
+
+FUGCPakPrefetcher::~FUGCPakPrefetcher()
+{
+	// Requests must complete before they and their handles can be destroyed. Queued ranges are simply dropped
+	for (FPendingRead& PendingRead : PendingReads)
+	{
+		if (PendingRead.Request)
+		{
+			PendingRead.Request->WaitCompletion();
+			delete PendingRead.Request;
+		}
+		delete PendingRead.Handle;
+	}
+}
+
+void FUGCPakPrefetcher::Prefetch(const TSharedRef<IPlugin>& Plugin)
+{
+	// Reads queued for earlier plugins are due before the reads of this one
+	IssueQueuedReads();
+
+	if (PrefetchedPlugins.Contains(Plugin->GetDescriptorFileName()))
+	{
+		return;
+	}
+	PrefetchedPlugins.Add(Plugin->GetDescriptorFileName());
+
+	TRACE_CPUPROFILER_EVENT_SCOPE(FUGCPakPrefetcher::Prefetch);
+	IPlatformFile& PlatformFile = IPlatformFile::GetPlatformPhysical();
+
+	TArray<FString> FoundPaks;
+	FPakFileSearchVisitor PakVisitor(FoundPaks);
+	PlatformFile.IterateDirectoryRecursively(*Plugin->GetContentDir(), PakVisitor);
+
+	for (const FString& PakPath : FoundPaks)
+	{
+		const int64 PakSize = PlatformFile.FileSize(*PakPath);
+		if (PakSize > 0)
+		{
+			const int64 TailSize = FMath::Min(PakSize, PakTailPrefetchSize);
+			PrefetchFileRange(PakPath, PakSize - TailSize, TailSize);
+		}
+	}
+
+	// Cooked registries live inside the paks, but side-loaded UGC can ship a loose one next to its descriptor
+	const FString LooseRegistryPath = Plugin->GetBaseDir() / TEXT("AssetRegistry.bin");
+	const int64 LooseRegistrySize = PlatformFile.FileSize(*LooseRegistryPath);
+	if (LooseRegistrySize > 0)
+	{
+		PrefetchFileRange(LooseRegistryPath, 0, LooseRegistrySize);
+	}
+
+	UE_LOG(LogModioUGC, VeryVerbose, TEXT("Prefetching %d pak files for UGC plugin %s"), FoundPaks.Num(),
+		   *Plugin->GetName());
+}
+
+void FUGCPakPrefetcher::PrefetchFileRange(const FString& FilePath, int64 Offset, int64 Size)
+{
+#if PLATFORM_LINUX
+	// Let the kernel read the range into the page cache in the background
+	const FString FullPath = FPaths::ConvertRelativePathToFull(FilePath);
+	const int FileDescriptor = open(TCHAR_TO_UTF8(*FullPath), O_RDONLY | O_CLOEXEC);
+	if (FileDescriptor >= 0)
+	{
+		posix_fadvise(FileDescriptor, Offset, Size, POSIX_FADV_WILLNEED);
+		close(FileDescriptor);
+	}
+#else
+	QueuedRanges.Add({FilePath, Offset, Size});
+	IssueQueuedReads();
+#endif
+}
+
+void FUGCPakPrefetcher::IssueQueuedReads()
+{
+	for (int32 ReadIndex = PendingReads.Num() - 1; ReadIndex >= 0; --ReadIndex)
+	{
+		FPendingRead& PendingRead = PendingReads[ReadIndex];
+		if (PendingRead.Request && !PendingRead.Request->PollCompletion())
+		{
+			continue;
+		}
+		delete PendingRead.Request;
+		delete PendingRead.Handle;
+		PendingReads.RemoveAtSwap(ReadIndex);
+	}
+
+	int32 NumIssued = 0;
+	while (NumIssued < QueuedRanges.Num() && PendingReads.Num() < MaxReadsInFlight)
+	{
+		const FFileRange& Range = QueuedRanges[NumIssued++];
+		IAsyncReadFileHandle* Handle = IPlatformFile::GetPlatformPhysical().OpenAsyncRead(*Range.FilePath);
+		if (!Handle)
+		{
+			continue;
+		}
+
+		// Precache requests only warm the file cache, no memory is allocated for the data
+		IAsyncReadRequest* Request = Handle->ReadRequest(Range.Offset, Range.Size, AIOP_Precache);
+		PendingReads.Add({Handle, Request});
+	}
+	QueuedRanges.RemoveAt(0, NumIssued);
+}
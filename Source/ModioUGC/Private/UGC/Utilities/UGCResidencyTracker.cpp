@@ -0,0 +1,151 @@
+/*
+ *  Copyright (C) 2025-2026 mod.io Pty Ltd. <https://mod.io>
+ *
+ *  This file is part of the mod.io ModioUGC Plugin.
+ *
+ *  Distributed under the MIT License. (See accompanying file LICENSE or
+ *   view online at <https://github.com/modio/modio-ue-modiougc/blob/main/LICENSE>)
+ *
+ */
+
+#include "UGC/Utilities/UGCResidencyTracker.h"
+
+#include "Misc/ScopeLock.h"
+
+void FUGCResidencyTracker::AddResident(FName DescriptorPath)
+{
+	FScopeLock ScopeLock(&Lock);
+	LastUseTimes.Add(DescriptorPath, FPlatformTime::Seconds());
+}
+
+void FUGCResidencyTracker::RemoveResident(FName DescriptorPath)
+{
+	FScopeLock ScopeLock(&Lock);
+	LastUseTimes.Remove(DescriptorPath);
+}
+
+void FUGCResidencyTracker::Touch(FName DescriptorPath)
+{
+	FScopeLock ScopeLock(&Lock);
+	if (double* LastUseTime = LastUseTimes.Find(DescriptorPath))
+	{
+		*LastUseTime = FPlatformTime::Seconds();
+	}
+}
+
+void FUGCResidencyTracker::Pin(FName DescriptorPath)
+{
+	FScopeLock ScopeLock(&Lock);
+	++PinCounts.FindOrAdd(DescriptorPath);
+}
+
+bool FUGCResidencyTracker::Unpin(FName DescriptorPath)
+{
+	FScopeLock ScopeLock(&Lock);
+	int32* PinCount = PinCounts.Find(DescriptorPath);
+	if (!PinCount)
+	{
+		return false;
+	}
+	if (--*PinCount == 0)
+	{
+		PinCounts.Remove(DescriptorPath);
+	}
+	return true;
+}
+
+bool FUGCResidencyTracker::IsPinned(FName DescriptorPath) const
+{
+	FScopeLock ScopeLock(&Lock);
+	return PinCounts.Contains(DescriptorPath);
+}
+
+TArray<FName> FUGCResidencyTracker::GetEvictionOrder() const
+{
+	TArray<TPair<double, FName>> Candidates;
+	{
+		FScopeLock ScopeLock(&Lock);
+		Candidates.Reserve(LastUseTimes.Num());
+		for (const TPair<FName, double>& LastUseTime : LastUseTimes)
+		{
+			if (!PinCounts.Contains(LastUseTime.Key))
+			{
+				Candidates.Emplace(LastUseTime.Value, LastUseTime.Key);
+			}
+		}
+	}
+
+	Candidates.Sort([](const TPair<double, FName>& A, const TPair<double, FName>& B) { return A.Key < B.Key; });
+
+	TArray<FName> EvictionOrder;
+	EvictionOrder.Reserve(Candidates.Num());
+	for (const TPair<double, FName>& Candidate : Candidates)
+	{
+		EvictionOrder.Add(Candidate.Value);
+	}
+	return EvictionOrder;
+}
+
+void FUGCResidencyTracker::AddEvicted(FEvictedPackage&& EvictedPackage)
+{
+	FScopeLock ScopeLock(&Lock);
+	const FName MountRoot = EvictedPackage.MountRoot;
+	EvictedPackages.Add(MountRoot, MoveTemp(EvictedPackage));
+}
+
+TOptional<FUGCResidencyTracker::FEvictedPackage> FUGCResidencyTracker::TakeEvictedByMountRoot(FName MountRoot)
+{
+	FScopeLock ScopeLock(&Lock);
+	FEvictedPackage EvictedPackage;
+	if (EvictedPackages.RemoveAndCopyValue(MountRoot, EvictedPackage))
+	{
+		return EvictedPackage;
+	}
+	return {};
+}
+
+TOptional<FUGCResidencyTracker::FEvictedPackage> FUGCResidencyTracker::TakeEvictedByModID(FGenericModID ModID)
+{
+	FScopeLock ScopeLock(&Lock);
+	for (auto It = EvictedPackages.CreateIterator(); It; ++It)
+	{
+		if (It->Value.ModID.IsSet() && It->Value.ModID.GetValue() == ModID)
+		{
+			FEvictedPackage EvictedPackage = MoveTemp(It->Value);
+			It.RemoveCurrent();
+			return EvictedPackage;
+		}
+	}
+	return {};
+}
+
+void FUGCResidencyTracker::RemoveEvictedByModID(FGenericModID ModID)
+{
+	FScopeLock ScopeLock(&Lock);
+	for (auto It = EvictedPackages.CreateIterator(); It; ++It)
+	{
+		if (It->Value.ModID.IsSet() && It->Value.ModID.GetValue() == ModID)
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
+
+bool FUGCResidencyTracker::IsEvicted(FGenericModID ModID) const
+{
+	FScopeLock ScopeLock(&Lock);
+	for (const TPair<FName, FEvictedPackage>& EvictedPackage : EvictedPackages)
+	{
+		if (EvictedPackage.Value.ModID.IsSet() && EvictedPackage.Value.ModID.GetValue() == ModID)
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+void FUGCResidencyTracker::EmptyEvicted()
+{
+	FScopeLock ScopeLock(&Lock);
+	EvictedPackages.Empty();
+}
@@ -0,0 +1,180 @@
+/*
+ *  Copyright (C) 2025-2026 mod.io Pty Ltd. <https://mod.io>
+ *
+ *  This file is part of the mod.io ModioUGC Plugin.
+ *
+ *  Distributed under the MIT License. (See accompanying file LICENSE or
+ *   view online at <https://github.com/modio/modio-ue-modiougc/blob/main/LICENSE>)
+ *
+ */
+
+#include "UGC/Utilities/UGCShaderLibraryRegistry.h"
+
+#include "Interfaces/IPluginManager.h"
+#include "Misc/CoreDelegates.h"
+#include "Misc/EngineVersionComparison.h"
+#include "ModioUGC.h"
+#include "ShaderCodeLibrary.h"
+#include "UGC/UGCStats.h"
+
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Open Shader Libraries"), STAT_UGCOpenShaderLibraries, STATGROUP_ModioUGC);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Pending Lazy Shader Libraries"), STAT_UGCPendingShaderLibraries,
+							   STATGROUP_ModioUGC);
+
+FUGCShaderLibraryRegistry& FUGCShaderLibraryRegistry::Get()
+{
+	static FUGCShaderLibraryRegistry Instance;
+	return Instance;
+}
+
+void FUGCShaderLibraryRegistry::Register(const TSharedRef<IPlugin>& Plugin, bool bLazy)
+{
+	if (!bLazy)
+	{
+		OpenLibrary(Plugin);
+		return;
+	}
+
+	{
+		FScopeLock ScopeLock(&Lock);
+		if (OpenLibraries.Contains(Plugin->GetName()))
+		{
+			return;
+		}
+		PendingLibraries.Add(Plugin->GetMountedAssetPath(), Plugin);
+		BindLoadDelegates();
+	}
+
+	UE_LOG(LogModioUGC, Verbose, TEXT("Registered shader library for plugin '%s' to open on first use from %s"),
+		   *Plugin->GetName(), *Plugin->GetMountedAssetPath());
+	UpdateStats();
+}
+
+void FUGCShaderLibraryRegistry::Unregister(const TSharedRef<IPlugin>& Plugin)
+{
+	bool bWasOpen = false;
+	{
+		FScopeLock ScopeLock(&Lock);
+		PendingLibraries.Remove(Plugin->GetMountedAssetPath());
+		if (PendingLibraries.IsEmpty())
+		{
+			UnbindLoadDelegates();
+		}
+		bWasOpen = OpenLibraries.Remove(Plugin->GetName()) > 0;
+	}
+
+	if (bWasOpen)
+	{
+		UE_LOG(LogModioUGC, Verbose, TEXT("Closing shader library for plugin '%s'"), *Plugin->GetName());
+		FShaderCodeLibrary::CloseLibrary(Plugin->GetName());
+	}
+	UpdateStats();
+}
+
+bool FUGCShaderLibraryRegistry::IsOpen(const FString& LibraryName) const
+{
+	FScopeLock ScopeLock(&Lock);
+	return OpenLibraries.Contains(LibraryName);
+}
+
+int32 FUGCShaderLibraryRegistry::GetNumOpenLibraries() const
+{
+	FScopeLock ScopeLock(&Lock);
+	return OpenLibraries.Num();
+}
+
+int32 FUGCShaderLibraryRegistry::GetNumPendingLibraries() const
+{
+	FScopeLock ScopeLock(&Lock);
+	return PendingLibraries.Num();
+}
+
+void FUGCShaderLibraryRegistry::OnPackageLoadRequested(const FString& PackageName)
+{
+	// Package names look like "/RedSpaceship/Meshes/Hull", so the mount point is everything up to the second slash
+	if (PackageName.Len() < 2 || PackageName[0] != TEXT('/'))
+	{
+		return;
+	}
+	const int32 MountPointEnd = PackageName.Find(TEXT("/"), ESearchCase::CaseSensitive, ESearchDir::FromStart, 1);
+	if (MountPointEnd == INDEX_NONE)
+	{
+		return;
+	}
+
+	TSharedPtr<IPlugin> PluginToOpen;
+	{
+		FScopeLock ScopeLock(&Lock);
+		const FString MountPoint = PackageName.Left(MountPointEnd + 1);
+		const TSharedRef<IPlugin>* PendingPlugin = PendingLibraries.Find(MountPoint);
+		if (!PendingPlugin)
+		{
+			return;
+		}
+		PluginToOpen = *PendingPlugin;
+		PendingLibraries.Remove(MountPoint);
+		if (PendingLibraries.IsEmpty())
+		{
+			UnbindLoadDelegates();
+		}
+	}
+
+	UE_LOG(LogModioUGC, Verbose, TEXT("Lazily opening shader library for plugin '%s' on load of %s"),
+		   *PluginToOpen->GetName(), *PackageName);
+	OpenLibrary(PluginToOpen.ToSharedRef());
+}
+
+void FUGCShaderLibraryRegistry::OpenLibrary(const TSharedRef<IPlugin>& Plugin)
+{
+#if UE_VERSION_NEWER_THAN(5, 3, 0)
+	UE_LOG(LogModioUGC, Verbose, TEXT("Opening shader library for plugin '%s'"), *Plugin->GetName());
+	FShaderCodeLibrary::OpenPluginShaderLibrary(*Plugin);
+#else
+	if (!Plugin->CanContainContent() || !Plugin->IsEnabled())
+	{
+		return;
+	}
+	UE_LOG(LogModioUGC, Verbose, TEXT("Opening shader library at '%s'"), *Plugin->GetContentDir());
+	FShaderCodeLibrary::OpenLibrary(Plugin->GetName(), Plugin->GetContentDir());
+#endif
+
+	{
+		FScopeLock ScopeLock(&Lock);
+		OpenLibraries.Add(Plugin->GetName());
+	}
+	UpdateStats();
+}
+
+void FUGCShaderLibraryRegistry::BindLoadDelegates()
+{
+	if (!SyncLoadHandle.IsValid())
+	{
+		SyncLoadHandle =
+			FCoreDelegates::OnSyncLoadPackage.AddRaw(this, &FUGCShaderLibraryRegistry::OnPackageLoadRequested);
+	}
+	if (!AsyncLoadHandle.IsValid())
+	{
+		AsyncLoadHandle =
+			FCoreDelegates::OnAsyncLoadPackage.AddRaw(this, &FUGCShaderLibraryRegistry::OnPackageLoadRequested);
+	}
+}
+
+void FUGCShaderLibraryRegistry::UnbindLoadDelegates()
+{
+	if (SyncLoadHandle.IsValid())
+	{
+		FCoreDelegates::OnSyncLoadPackage.Remove(SyncLoadHandle);
+		SyncLoadHandle.Reset();
+	}
+	if (AsyncLoadHandle.IsValid())
+	{
+		FCoreDelegates::OnAsyncLoadPackage.Remove(AsyncLoadHandle);
+		AsyncLoadHandle.Reset();
+	}
+}
+
+void FUGCShaderLibraryRegistry::UpdateStats() const
+{
+	SET_DWORD_STAT(STAT_UGCOpenShaderLibraries, GetNumOpenLibraries());
+	SET_DWORD_STAT(STAT_UGCPendingShaderLibraries, GetNumPendingLibraries());
+}
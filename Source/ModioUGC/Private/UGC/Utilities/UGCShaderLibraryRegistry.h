@@ -0,0 +1,68 @@
+/*
+ *  Copyright (C) 2025-2026 mod.io Pty Ltd. <https://mod.io>
+ *
+ *  This file is part of the mod.io ModioUGC Plugin.
+ *
+ *  Distributed under the MIT License. (See accompanying file LICENSE or
+ *   view online at <https://github.com/modio/modio-ue-modiougc/blob/main/LICENSE>)
+ *
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class IPlugin;
+
+/**
+ * Tracks the shader libraries of mounted UGC packages.
+ *
+ * Libraries are either opened immediately, or registered lazily and opened the first time a package is requested for
+ * loading from the mount point of the UGC package, which is when its materials first look up their shaders.
+ */
+class FUGCShaderLibraryRegistry
+{
+public:
+	static FUGCShaderLibraryRegistry& Get();
+
+	/**
+	 * Registers the shader library of a UGC plugin
+	 *
+	 * @param Plugin The UGC plugin owning the library
+	 * @param bLazy Whether to defer opening the library until content is loaded from the plugin mount point
+	 */
+	void Register(const TSharedRef<IPlugin>& Plugin, bool bLazy);
+
+	/**
+	 * Unregisters the shader library of a UGC plugin, closing it if it was opened
+	 *
+	 * @param Plugin The UGC plugin owning the library
+	 */
+	void Unregister(const TSharedRef<IPlugin>& Plugin);
+
+	/**
+	 * Whether the shader library of a UGC plugin is currently open
+	 */
+	bool IsOpen(const FString& LibraryName) const;
+
+	int32 GetNumOpenLibraries() const;
+	int32 GetNumPendingLibraries() const;
+
+private:
+	void OnPackageLoadRequested(const FString& PackageName);
+	void OpenLibrary(const TSharedRef<IPlugin>& Plugin);
+	void BindLoadDelegates();
+	void UnbindLoadDelegates();
+	void UpdateStats() const;
+
+	mutable FCriticalSection Lock;
+
+	/** Plugins whose library is waiting to be opened, keyed by mount point (e.g. "/RedSpaceship/") */
+	TMap<FString, TSharedRef<IPlugin>> PendingLibraries;
+
+	/** Names of the libraries that are currently open */
+	TSet<FString> OpenLibraries;
+
+	FDelegateHandle SyncLoadHandle;
+	FDelegateHandle AsyncLoadHandle;
+};
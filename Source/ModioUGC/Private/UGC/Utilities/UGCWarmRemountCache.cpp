@@ -0,0 +1,153 @@
+/*
+ *  Copyright (C) 2025-2026 mod.io Pty Ltd. <https://mod.io>
+ *
+ *  This file is part of the mod.io ModioUGC Plugin.
+ *
+ *  Distributed under the MIT License. (See accompanying file LICENSE or
+ *   view online at <https://github.com/modio/modio-ue-modiougc/blob/main/LICENSE>)
+ *
+ */
+
+#include "UGC/Utilities/UGCWarmRemountCache.h"
+
+#include "AssetRegistry/AssetRegistryState.h"
+#include "ModioUGC.h"
+#include "UGC/Types/UGCPackage.h"
+#include "UGC/UGCStats.h"
+#include "UGC/Utilities/UGCFileIndex.h"
+
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Warm Remount Cache Entries"), STAT_UGCWarmRemountEntries, STATGROUP_ModioUGC);
+DECLARE_MEMORY_STAT(TEXT("Warm Remount Cache Memory"), STAT_UGCWarmRemountMemory, STATGROUP_ModioUGC);
+
+FUGCWarmRemountCache& FUGCWarmRemountCache::Get()
+{
+	static FUGCWarmRemountCache Instance;
+	return Instance;
+}
+
+void FUGCWarmRemountCache::Retain(const FUGCPackage& Package, SIZE_T BudgetBytes)
+{
+	const FUGCPackageState& State = Package.GetState();
+	if (!State.LoadedAssetRegistryState.IsValid() || State.MountedPakFilePaths.IsEmpty())
+	{
+		return;
+	}
+
+	FUGCWarmRemountEntry Entry;
+	Entry.PakPaths = State.MountedPakFilePaths;
+	IPlatformFile& PlatformFile = IPlatformFile::GetPlatformPhysical();
+	for (const FString& PakPath : Entry.PakPaths)
+	{
+		Entry.PakStats.Add(PlatformFile.GetStatData(*PakPath));
+	}
+	Entry.RegistryState = State.LoadedAssetRegistryState;
+	Entry.FileIndex = State.FileIndex;
+	Entry.AllocatedSize = sizeof(FUGCWarmRemountEntry) + Entry.RegistryState->GetAllocatedSize() +
+						  (Entry.FileIndex.IsValid() ? Entry.FileIndex->GetAllocatedSize() : 0);
+	Entry.RetainTime = FPlatformTime::Seconds();
+
+	if (Entry.AllocatedSize > BudgetBytes)
+	{
+		UE_LOG(LogModioUGC, Verbose, TEXT("UGC `%s` needs %llu bytes to be retained, which exceeds the budget"),
+			   *Package.GetFriendlyName(), static_cast<uint64>(Entry.AllocatedSize));
+		return;
+	}
+
+	const FName DescriptorPath = Package.GetInfo().DescriptorPath;
+	const SIZE_T EntrySize = Entry.AllocatedSize;
+	{
+		FScopeLock ScopeLock(&Lock);
+		if (const FUGCWarmRemountEntry* ExistingEntry = Entries.Find(DescriptorPath))
+		{
+			RetainedSize -= ExistingEntry->AllocatedSize;
+		}
+		Entries.Add(DescriptorPath, MoveTemp(Entry));
+		RetainedSize += EntrySize;
+		EvictToBudget(BudgetBytes);
+	}
+
+	UE_LOG(LogModioUGC, Verbose, TEXT("Retained UGC `%s` for warm remount (%llu bytes, %llu bytes retained in total)"),
+		   *Package.GetFriendlyName(), static_cast<uint64>(EntrySize), static_cast<uint64>(GetRetainedSize()));
+}
+
+TOptional<FUGCWarmRemountEntry> FUGCWarmRemountCache::Take(FName DescriptorPath, const TArray<FString>& PakPaths)
+{
+	FUGCWarmRemountEntry Entry;
+	{
+		FScopeLock ScopeLock(&Lock);
+		if (!Entries.RemoveAndCopyValue(DescriptorPath, Entry))
+		{
+			return {};
+		}
+		RetainedSize -= Entry.AllocatedSize;
+		SET_DWORD_STAT(STAT_UGCWarmRemountEntries, Entries.Num());
+		SET_MEMORY_STAT(STAT_UGCWarmRemountMemory, RetainedSize);
+	}
+
+	if (Entry.PakPaths != PakPaths)
+	{
+		UE_LOG(LogModioUGC, Verbose, TEXT("Pak files of %s changed since it was unmounted, discarding retained data"),
+			   *DescriptorPath.ToString());
+		return {};
+	}
+
+	IPlatformFile& PlatformFile = IPlatformFile::GetPlatformPhysical();
+	for (int32 PakIndex = 0; PakIndex < PakPaths.Num(); ++PakIndex)
+	{
+		const FFileStatData StatData = PlatformFile.GetStatData(*PakPaths[PakIndex]);
+		const FFileStatData& RetainedStatData = Entry.PakStats[PakIndex];
+		if (!StatData.bIsValid || StatData.FileSize != RetainedStatData.FileSize ||
+			StatData.ModificationTime != RetainedStatData.ModificationTime)
+		{
+			UE_LOG(LogModioUGC, Verbose, TEXT("Pak file %s changed since it was unmounted, discarding retained data"),
+				   *PakPaths[PakIndex]);
+			return {};
+		}
+	}
+
+	return Entry;
+}
+
+void FUGCWarmRemountCache::Empty()
+{
+	FScopeLock ScopeLock(&Lock);
+	Entries.Empty();
+	RetainedSize = 0;
+	SET_DWORD_STAT(STAT_UGCWarmRemountEntries, 0);
+	SET_MEMORY_STAT(STAT_UGCWarmRemountMemory, 0);
+}
+
+int32 FUGCWarmRemountCache::Num() const
+{
+	FScopeLock ScopeLock(&Lock);
+	return Entries.Num();
+}
+
+SIZE_T FUGCWarmRemountCache::GetRetainedSize() const
+{
+	FScopeLock ScopeLock(&Lock);
+	return RetainedSize;
+}
+
+void FUGCWarmRemountCache::EvictToBudget(SIZE_T BudgetBytes)
+{
+	while (RetainedSize > BudgetBytes && Entries.Num() > 0)
+	{
+		auto OldestEntry = Entries.CreateIterator();
+		for (auto It = Entries.CreateIterator(); It; ++It)
+		{
+			if (It->Value.RetainTime < OldestEntry->Value.RetainTime)
+			{
+				OldestEntry = It;
+			}
+		}
+
+		UE_LOG(LogModioUGC, Verbose, TEXT("Evicting retained UGC %s from the warm remount cache"),
+			   *OldestEntry->Key.ToString());
+		RetainedSize -= OldestEntry->Value.AllocatedSize;
+		OldestEntry.RemoveCurrent();
+	}
+
+	SET_DWORD_STAT(STAT_UGCWarmRemountEntries, Entries.Num());
+	SET_MEMORY_STAT(STAT_UGCWarmRemountMemory, RetainedSize);
+}
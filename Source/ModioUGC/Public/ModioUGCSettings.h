@@ -115,6 +115,29 @@ public:
 	UPROPERTY(Config, EditAnywhere, Meta = (DisplayName = "Auto Initialize UGC Provider"), Category = "UGC Provider")
 	bool bAutoInitializeUGCProvider = false;
 
+	/**
+	 * @brief Whether the mod.io UGC provider enables mod management and mounts or unmounts the UGC of each mod as it is
+	 * installed, updated or uninstalled, instead of waiting for a full refresh. Leave disabled when gameplay code
+	 * enables mod management itself, and forward its events to UModioUGCProvider::HandleModManagementEvent instead
+	 */
+	UPROPERTY(Config, EditAnywhere, Meta = (DisplayName = "Mount UGC On Mod Management Events"),
+			  Category = "UGC Provider")
+	bool bMountUGCOnModManagementEvents = false;
+
+	/**
+	 * @brief Directories the side-load UGC provider finds UGC folders in, highest priority first. Relative directories
+	 * are relative to the project directory. When empty, UGC is side-loaded from the "Modio" project subdirectory
+	 */
+	UPROPERTY(Config, EditAnywhere, Meta = (DisplayName = "Side-Load UGC Roots"), Category = "UGC Provider")
+	TArray<FString> SideLoadUGCRoots;
+
+	/**
+	 * @brief Name of the file holding the mod ID of a side-loaded UGC folder. Folders without one get their mod ID from
+	 * their name when it starts with one, such as "1234_RedSpaceship"
+	 */
+	UPROPERTY(Config, EditAnywhere, Meta = (DisplayName = "Side-Load Mod ID File Name"), Category = "UGC Provider")
+	FString SideLoadModIDFileName = TEXT("modid.txt");
+
 #if WITH_EDITORONLY_DATA
 	/**
 	 * @brief Whether we should enable the underlying UGC provider (mod.io) in-editor. Should be used for local
@@ -136,6 +159,153 @@ public:
 	UPROPERTY(Config, EditAnywhere, meta = (DisplayName = "Enable Mod Enable/Disable support"), Category = "Project")
 	bool bEnableModEnableDisableFeature = false;
 
+	/**
+	 * @brief Whether the footers and indices of the pak files of a UGC package should be read and validated
+	 * concurrently on worker threads before the paks are mounted. The paks are still mounted one at a time on the
+	 * mounting thread, since mounting broadcasts the pak mounted delegates. Mostly benefits large UGC packages that
+	 * ship many pak chunks. The ugc.benchmarkpakmount console command of the ModioUGCTesting module measures the
+	 * difference.
+	 */
+	UPROPERTY(Config, EditAnywhere, meta = (DisplayName = "Preload Pak Indices In Parallel"), Category = "Performance")
+	bool bMountPakFilesInParallel = false;
+
+	/**
+	 * @brief Whether the shader library of a UGC package should only be opened the first time content is loaded from
+	 * its mount point, rather than when the package is mounted. Saves reading shader library headers and allocating
+	 * lookup tables for UGC that never renders in the session.
+	 */
+	UPROPERTY(Config, EditAnywhere, meta = (DisplayName = "Lazy Open UGC Shader Libraries"), Category = "Performance")
+	bool bLazyOpenUGCShaderLibraries = false;
+
+	/**
+	 * @brief Number of queued UGC packages to read ahead while the current package is being mounted. The pak indices
+	 * and loose asset registries of upcoming packages are prefetched so cold-disk I/O overlaps with mounting work.
+	 * Set to 0 to disable prefetching.
+	 */
+	UPROPERTY(Config, EditAnywhere, meta = (DisplayName = "UGC Prefetch Depth", ClampMin = 0), Category = "Performance")
+	int32 UGCPrefetchDepth = 2;
+
+	/**
+	 * @brief Whether the pak files of a UGC package, and the IoStore containers (.utoc/.ucas) next to them, should be
+	 * verified against their stored digest ("<File>.xxh64") before mounting. Files are hashed in parallel chunks and
+	 * results are cached by file size and modification time, so only new or changed files are hashed on later runs.
+	 * Packages with damaged files are not mounted.
+	 */
+	UPROPERTY(Config, EditAnywhere, meta = (DisplayName = "Verify UGC Content Before Mount"), Category = "Performance")
+	bool bVerifyUGCContentBeforeMount = false;
+
+	/**
+	 * @brief Whether UGC paks without a stored digest should fail verification. When disabled, such paks are mounted
+	 * without being verified.
+	 */
+	UPROPERTY(Config, EditAnywhere,
+			  meta = (DisplayName = "Require UGC Content Digest", EditCondition = "bVerifyUGCContentBeforeMount"),
+			  Category = "Performance")
+	bool bRequireUGCContentDigest = false;
+
+	/**
+	 * @brief Whether the paks and loose asset registries of mounted and installed UGC should be verified again on a
+	 * lowest priority thread while the game is idle. Damaged packages are reported to the UGC provider for repair, and
+	 * the refreshed digests are cached so verification before mount does not hash unchanged paks again. Paks without a
+	 * stored digest are only checked for a readable footer and index.
+	 */
+	UPROPERTY(Config, EditAnywhere, meta = (DisplayName = "Enable Background UGC Verification"),
+			  Category = "Performance")
+	bool bEnableBackgroundUGCVerification = false;
+
+	/**
+	 * @brief Maximum rate in megabytes per second at which background verification reads UGC files.
+	 */
+	UPROPERTY(Config, EditAnywhere,
+			  meta = (DisplayName = "Background UGC Verification Read Rate (MB/s)", ClampMin = 1,
+					  EditCondition = "bEnableBackgroundUGCVerification"),
+			  Category = "Performance")
+	int32 BackgroundUGCVerificationReadRateMB = 8;
+
+	/**
+	 * @brief Number of seconds without UGC being mounted or packages being loaded asynchronously before the game is
+	 * considered idle. Background verification pauses as soon as the game stops being idle.
+	 */
+	UPROPERTY(Config, EditAnywhere,
+			  meta = (DisplayName = "Background UGC Verification Idle Delay", ClampMin = 0, Units = "s",
+					  EditCondition = "bEnableBackgroundUGCVerification"),
+			  Category = "Performance")
+	float BackgroundUGCVerificationIdleDelay = 10.0f;
+
+	/**
+	 * @brief Minimum number of seconds between the end of a background verification pass and the start of the next.
+	 */
+	UPROPERTY(Config, EditAnywhere,
+			  meta = (DisplayName = "Background UGC Verification Interval", ClampMin = 0, Units = "s",
+					  EditCondition = "bEnableBackgroundUGCVerification"),
+			  Category = "Performance")
+	float BackgroundUGCVerificationInterval = 3600.0f;
+
+	/**
+	 * @brief Whether the asset registry and file index of unmounted UGC packages should be kept in memory, so that
+	 * packages that are mounted again with unchanged pak files (e.g. a mod toggled off and on, or a RefreshUGC) skip
+	 * loading their registry, verifying their paks and capturing their file lists.
+	 */
+	UPROPERTY(Config, EditAnywhere, meta = (DisplayName = "Enable UGC Warm Remount Cache"), Category = "Performance")
+	bool bEnableUGCWarmRemountCache = false;
+
+	/**
+	 * @brief Maximum memory in megabytes kept by the warm remount cache. The least recently unmounted packages are
+	 * evicted first.
+	 */
+	UPROPERTY(Config, EditAnywhere,
+			  meta = (DisplayName = "UGC Warm Remount Cache Size (MB)", ClampMin = 1,
+					  EditCondition = "bEnableUGCWarmRemountCache"),
+			  Category = "Performance")
+	int32 UGCWarmRemountCacheSizeMB = 64;
+
+	/**
+	 * @brief Whether mounted UGC packages should be kept within a memory budget. When the packages use more than the
+	 * budget, the least recently used packages that are not pinned and have no loaded content are unloaded. Evicted
+	 * packages are mounted again synchronously by EnsureUGCPackageResidentByModID and
+	 * EnsureUGCPackageResidentForPackageName, which have to be called before loading content that may have been
+	 * evicted. Loads that skip them fail, and the package is mounted again on the next tick.
+	 */
+	UPROPERTY(Config, EditAnywhere, meta = (DisplayName = "Enable UGC Residency Manager"), Category = "Performance")
+	bool bEnableUGCResidencyManager = false;
+
+	/**
+	 * @brief Memory budget in megabytes for the pak indices, file indices and asset registries of mounted UGC packages,
+	 * which GetUGCMemoryReport breaks down per package. Loaded content is not counted, as packages with loaded content
+	 * are never evicted.
+	 */
+	UPROPERTY(Config, EditAnywhere,
+			  meta = (DisplayName = "UGC Residency Budget (MB)", ClampMin = 1,
+					  EditCondition = "bEnableUGCResidencyManager"),
+			  Category = "Performance")
+	int32 UGCResidencyBudgetMB = 512;
+
+	/**
+	 * @brief Whether to verify that the objects of a UGC package are gone after it is unloaded. Surviving objects are
+	 * logged as warnings along with the reference chains keeping them alive (non-shipping builds), so leaks can be
+	 * caught in soak runs. Searching reference chains walks the whole object graph, so passes are throttled.
+	 */
+	UPROPERTY(Config, EditAnywhere, meta = (DisplayName = "Detect UGC Leaks After Unload"), Category = "Diagnostics")
+	bool bDetectUGCLeaksAfterUnload = false;
+
+	/**
+	 * @brief Minimum number of seconds between two UGC leak detection passes. Unloads in between are not verified.
+	 */
+	UPROPERTY(Config, EditAnywhere,
+			  meta = (DisplayName = "UGC Leak Detection Interval", ClampMin = 0, Units = "s",
+					  EditCondition = "bDetectUGCLeaksAfterUnload"),
+			  Category = "Diagnostics")
+	float UGCLeakDetectionInterval = 60.0f;
+
+	/**
+	 * @brief Maximum number of surviving objects to search reference chains for in each leak detection pass.
+	 */
+	UPROPERTY(Config, EditAnywhere,
+			  meta = (DisplayName = "UGC Leak Max Reference Chains", ClampMin = 0,
+					  EditCondition = "bDetectUGCLeaksAfterUnload"),
+			  Category = "Diagnostics")
+	int32 UGCLeakMaxReferenceChains = 4;
+
 	/**
 	 * @brief Whether we should perform a check of the version of Unreal Engine that was used for UGC plugins that are
 	 * loaded against the current version of Unreal Engine being run, or the version that was used to build the game if
@@ -0,0 +1,144 @@
+/*
+ *  Copyright (C) 2025-2026 mod.io Pty Ltd. <https://mod.io>
+ *
+ *  This file is part of the mod.io ModioUGC Plugin.
+ *
+ *  Distributed under the MIT License. (See accompanying file LICENSE or
+ *   view online at <https://github.com/modio/modio-ue-modiougc/blob/main/LICENSE>)
+ *
+ */
+
+#pragma once
+
+#include "UGCProvider.h"
+#include "UObject/Object.h"
+
+#include "CompositeUGCProvider.generated.h"
+
+/**
+ * A child provider of a composite UGC provider
+ */
+USTRUCT(BlueprintType)
+struct MODIOUGC_API FCompositeUGCProviderSource
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "mod.io|UGC|Provider")
+	TScriptInterface<IUGCProvider> Provider;
+
+	/**
+	 * When several sources provide the same path or the same mod, the source with the highest priority wins
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "mod.io|UGC|Provider")
+	int32 Priority = 0;
+
+	/**
+	 * Whether the native GetInstalledUGCPaths_Implementation of the provider can be called off the game thread, so it
+	 * is queried concurrently with the other sources. Ignored for Blueprint classes, which are always queried on the
+	 * game thread
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "mod.io|UGC|Provider")
+	bool bQueryOffGameThread = false;
+};
+
+/**
+ * UGC provider combining several child providers, e.g. mod.io installs with side-loaded content.
+ *
+ * Initialization and deinitialization are started on every source at once and report a single result when all of them
+ * completed. Installed paths are gathered from all enabled sources and merged in priority order, dropping paths and
+ * mod IDs already provided by a higher priority source.
+ */
+UCLASS(BlueprintType)
+class MODIOUGC_API UCompositeUGCProvider : public UObject, public IUGCProvider
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	 * Adds a child provider. Sources should be added before the provider is initialized
+	 * @param Source The provider to add, with its priority
+	 */
+	UFUNCTION(BlueprintCallable, Category = "mod.io|UGC|Provider")
+	void AddSource(const FCompositeUGCProviderSource& Source);
+
+	/**
+	 * Removes a child provider
+	 * @param Provider The provider to remove
+	 */
+	UFUNCTION(BlueprintCallable, Category = "mod.io|UGC|Provider")
+	void RemoveSource(TScriptInterface<IUGCProvider> Provider);
+
+	/**
+	 * Gets the child providers, highest priority first
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "mod.io|UGC|Provider")
+	const TArray<FCompositeUGCProviderSource>& GetSources() const;
+
+protected:
+	//~ Begin IUGCProvider Interface
+	virtual void InitializeProvider_Implementation(const FOnUGCProviderInitializedDelegate& Handler) override;
+	virtual void DeinitializeProvider_Implementation(const FOnUGCProviderDeinitializedDelegate& Handler) override;
+	virtual bool IsProviderEnabled_Implementation() override;
+	virtual FModUGCPathMap GetInstalledUGCPaths_Implementation() override;
+	virtual bool GetUGCLoadPriority_Implementation(const FString& UGCPath, FGenericModID ModID,
+												   int32& OutPriority) override;
+	virtual void ReportDamagedUGC_Implementation(const FString& UGCPath, FGenericModID ModID,
+												 const TArray<FString>& DamagedFiles) override;
+	//~ End IUGCProvider Interface
+
+public:
+	//~ Begin IUGCProvider Interface
+	virtual void GetInstalledUGCPathsAsync(FOnUGCPathsBatchDelegate OnBatch) override;
+	//~ End IUGCProvider Interface
+
+private:
+	/** State of an asynchronous enumeration of all sources */
+	struct FAsyncEnumeration;
+
+	/**
+	 * Keeps the paths of a source not already provided by a higher priority source, remembering the source of each
+	 * @return The paths to keep
+	 */
+	FModUGCPathMap MergeSourcePaths(const FModUGCPathMap& SourcePaths, UObject* Provider, TSet<FString>& SeenPaths,
+									TSet<FGenericModID>& SeenModIDs, int32& NumDuplicates);
+
+	/**
+	 * Forwards the batches of an asynchronous enumeration in source priority order. Batches of a source are held back
+	 * until every higher priority source has completed, so duplicates can still be dropped
+	 */
+	void ForwardEnumeratedBatches(const TSharedRef<FAsyncEnumeration>& Enumeration);
+
+	UFUNCTION()
+	void OnSourceInitialized(bool bSuccess);
+
+	UFUNCTION()
+	void OnSourceDeinitialized(bool bSuccess);
+
+	void FinishPendingInitialization();
+	void FinishPendingDeinitialization();
+
+	/**
+	 * Child providers, highest priority first
+	 */
+	UPROPERTY()
+	TArray<FCompositeUGCProviderSource> Sources;
+
+	UPROPERTY()
+	FOnUGCProviderInitializedDelegate InitializedHandler;
+
+	UPROPERTY()
+	FOnUGCProviderDeinitializedDelegate DeinitializedHandler;
+
+	/** Sources that haven't reported their initialization result yet */
+	int32 PendingInitializations = 0;
+	bool bAnySourceInitialized = false;
+
+	/** Sources that haven't reported their deinitialization result yet */
+	int32 PendingDeinitializations = 0;
+	bool bAllSourcesDeinitialized = true;
+
+	/**
+	 * Source that provided each path in the last merge, so load priorities are resolved by the same source
+	 */
+	TMap<FString, TWeakObjectPtr<UObject>> PathToSourceMap;
+};
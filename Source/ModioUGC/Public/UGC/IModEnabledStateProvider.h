@@ -20,6 +20,31 @@ DECLARE_DYNAMIC_DELEGATE_TwoParams(FModEnabledStateChangeHandler, FGenericModID,
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnModEnabledStateChangeMulticastDelegate, FGenericModID, RawID, bool,
 											 bNewEnabledState);
 
+/**
+ * A single change of a mod's enabled state
+ */
+USTRUCT(BlueprintType)
+struct MODIOUGC_API FModEnabledStateChange
+{
+	GENERATED_BODY()
+
+	/**
+	 * The mod whose state changed
+	 */
+	UPROPERTY(BlueprintReadOnly, Category = "mod.io|UGC")
+	FGenericModID ModID;
+
+	/**
+	 * The new enabled state of the mod
+	 */
+	UPROPERTY(BlueprintReadOnly, Category = "mod.io|UGC")
+	bool bEnabled = true;
+};
+
+DECLARE_DYNAMIC_DELEGATE_OneParam(FModEnabledStatesChangeHandler, const TArray<FModEnabledStateChange>&, Changes);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnModEnabledStatesChangeMulticastDelegate,
+											const TArray<FModEnabledStateChange>&, Changes);
+
 /**
  * Interface for querying or setting the enabled or disabled state for a mod
  * Extend this interface if you wish to provide mod priority functionality
@@ -54,6 +79,39 @@ protected:
 		return NativeRequestModEnabledStateChange(ID, bNewEnabledState);
 	}
 
+	virtual TArray<FModEnabledStateChange> NativeRequestModEnabledStateChanges(
+		const TMap<FGenericModID, bool>& NewStates)
+	{
+		// Providers without bulk support apply the changes one mod at a time
+		TArray<FModEnabledStateChange> Changes;
+		for (const TPair<FGenericModID, bool>& NewState : NewStates)
+		{
+			if (Execute_RequestModEnabledStateChange(_getUObject(), NewState.Key, NewState.Value))
+			{
+				FModEnabledStateChange& Change = Changes.AddDefaulted_GetRef();
+				Change.ModID = NewState.Key;
+				Change.bEnabled = NewState.Value;
+			}
+		}
+		return Changes;
+	}
+
+	TArray<FModEnabledStateChange> RequestModEnabledStateChanges_Implementation(
+		const TMap<FGenericModID, bool>& NewStates)
+	{
+		return NativeRequestModEnabledStateChanges(NewStates);
+	}
+
+	virtual bool NativeQueryModLoadPriority(FGenericModID ModID, int32& OutPriority)
+	{
+		return false;
+	}
+
+	bool QueryModLoadPriority_Implementation(FGenericModID ModID, int32& OutPriority)
+	{
+		return NativeQueryModLoadPriority(ModID, OutPriority);
+	}
+
 public:
 	/**
 	 * Queries if a mod is currently enabled
@@ -71,4 +129,23 @@ public:
 	 */
 	UFUNCTION(BlueprintCallable, BlueprintNativeEvent, Category = "UGC|Mod Enabled State Provider")
 	bool RequestModEnabledStateChange(FGenericModID ID, bool bNewEnabledState);
+
+	/**
+	 * Requests that the enabled state of several mods be changed at once, e.g. to apply a loadout. Calls
+	 * RequestModEnabledStateChange for each mod unless the provider supports bulk changes
+	 * @param NewStates The new enabled state of each mod to change
+	 * @return The changes that were applied
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintNativeEvent, Category = "UGC|Mod Enabled State Provider")
+	TArray<FModEnabledStateChange> RequestModEnabledStateChanges(const TMap<FGenericModID, bool>& NewStates);
+
+	/**
+	 * Queries the load priority for a mod. Packages with a higher priority are mounted first and win when several
+	 * packages ship the same file
+	 * @param ModID the raw ID for the mod to query
+	 * @param OutPriority the load priority for the mod, only valid when this returns true
+	 * @return true if this provider specifies a load priority for the mod, else false
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintNativeEvent, Category = "UGC|Mod Enabled State Provider")
+	bool QueryModLoadPriority(FGenericModID ModID, int32& OutPriority);
 };
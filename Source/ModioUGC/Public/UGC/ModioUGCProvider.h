@@ -10,6 +10,7 @@
 
 #pragma once
 
+#include "Types/ModioModManagementEvent.h"
 #include "UGCProvider.h"
 #include "UObject/Object.h"
 
@@ -23,6 +24,16 @@ class MODIOUGC_API UModioUGCProvider : public UObject, public IUGCProvider
 {
 	GENERATED_BODY()
 
+public:
+	/**
+	 * Mounts or unloads the UGC of a single mod in response to a mod management event, through
+	 * UUGCSubsystem::HandleModManagementEvent. Bound automatically when bMountUGCOnModManagementEvents is set. Gameplay
+	 * code enabling mod management itself can forward events here instead
+	 * @param Event The mod management event
+	 */
+	UFUNCTION(BlueprintCallable, Category = "mod.io|UGC|Provider")
+	void HandleModManagementEvent(const FModioModManagementEvent& Event);
+
 protected:
 	//~ Begin IUGCProvider Interface
 	virtual void InitializeProvider_Implementation(const FOnUGCProviderInitializedDelegate& Handler) override;
@@ -34,5 +45,8 @@ protected:
 #if MODIO_UGC_SUPPORTED_PLATFORM
 	/** Whether the UGC provider has been initialized. Only relevant when mod.io is used as the UGC provider */
 	bool bSuccessfullyInitializedModio = false;
+
+	/** Whether mod management was enabled by this provider, so it is disabled again on deinitialization */
+	bool bEnabledModManagement = false;
 #endif
 };
\ No newline at end of file
@@ -0,0 +1,169 @@
+/*
+ *  Copyright (C) 2025-2026 mod.io Pty Ltd. <https://mod.io>
+ *
+ *  This file is part of the mod.io ModioUGC Plugin.
+ *
+ *  Distributed under the MIT License. (See accompanying file LICENSE or
+ *   view online at <https://github.com/modio/modio-ue-modiougc/blob/main/LICENSE>)
+ *
+ */
+
+#pragma once
+
+#include "Async/Future.h"
+#include "IModEnabledStateProvider.h"
+#include "UObject/Object.h"
+
+#include "PersistentModEnabledStateProvider.generated.h"
+
+/**
+ * Built-in mod enabled state provider that keeps the state of every mod in memory for constant time lookups and
+ * persists it to a file in the saved directory.
+ *
+ * Changes are grouped in transactions: every bulk change is a transaction of its own, and several calls can be grouped
+ * with BeginTransaction/CommitTransaction. Each committed transaction broadcasts a single batched change event with the
+ * mods whose state actually changed, and schedules a single write of the state file on a worker thread. Writes are
+ * coalesced, so only the latest state is written when transactions are committed faster than the disk keeps up.
+ *
+ * Changes requested through IModEnabledStateProvider, such as by the UGC subsystem, are returned to the caller to
+ * broadcast instead. They are only broadcast by the provider when made within a transaction opened with
+ * BeginTransaction, once that transaction is committed.
+ */
+UCLASS(BlueprintType)
+class MODIOUGC_API UPersistentModEnabledStateProvider : public UObject, public IModEnabledStateProvider
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	 * Enabled state of mods that have never been enabled or disabled
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "mod.io|UGC|Mod Enabled State Provider")
+	bool bEnabledByDefault = true;
+
+	/**
+	 * Loads the persisted state, replacing the state in memory. Called automatically the first time the state is used
+	 * @param FilePath File to load the state from. Uses the default file in the saved directory when empty
+	 * @return true if the state file was read, false if it does not exist or is unreadable
+	 */
+	UFUNCTION(BlueprintCallable, Category = "mod.io|UGC|Mod Enabled State Provider")
+	bool LoadState(const FString& FilePath = TEXT(""));
+
+	/**
+	 * Gets the enabled state of several mods in a single call
+	 * @param ModIDs The mods to query
+	 * @return The enabled state of each queried mod
+	 */
+	UFUNCTION(BlueprintCallable, Category = "mod.io|UGC|Mod Enabled State Provider")
+	TMap<FGenericModID, bool> GetModsEnabled(const TArray<FGenericModID>& ModIDs);
+
+	/**
+	 * Gets the mods that have been explicitly enabled or disabled
+	 */
+	UFUNCTION(BlueprintCallable, Category = "mod.io|UGC|Mod Enabled State Provider")
+	TMap<FGenericModID, bool> GetAllModEnabledStates();
+
+	/**
+	 * Changes the enabled state of several mods as one transaction, e.g. to apply a loadout
+	 * @param NewStates The new enabled state of each mod to change
+	 * @return The number of mods whose state changed
+	 */
+	UFUNCTION(BlueprintCallable, Category = "mod.io|UGC|Mod Enabled State Provider")
+	int32 SetModsEnabled(const TMap<FGenericModID, bool>& NewStates);
+
+	/**
+	 * Starts grouping state changes. Transactions nest; changes are only broadcast and persisted once the outermost
+	 * transaction is committed
+	 */
+	UFUNCTION(BlueprintCallable, Category = "mod.io|UGC|Mod Enabled State Provider")
+	void BeginTransaction();
+
+	/**
+	 * Ends a transaction started with BeginTransaction
+	 */
+	UFUNCTION(BlueprintCallable, Category = "mod.io|UGC|Mod Enabled State Provider")
+	void CommitTransaction();
+
+	/**
+	 * Blocks until the state file has been written, e.g. before the application exits
+	 */
+	UFUNCTION(BlueprintCallable, Category = "mod.io|UGC|Mod Enabled State Provider")
+	void FlushPendingWrites();
+
+	/**
+	 * Registers a delegate for notifications when a transaction changed the state of one or more mods
+	 * @param Handler Delegate to be notified
+	 */
+	UFUNCTION(BlueprintCallable, Category = "mod.io|UGC|Events|Mod Enabled State Provider")
+	void AddModEnabledStatesChangeHandler(const FModEnabledStatesChangeHandler& Handler);
+
+	/**
+	 * Unregisters a delegate for notifications when a transaction changed the state of one or more mods
+	 * @param Handler Delegate to be removed from the notification list
+	 */
+	UFUNCTION(BlueprintCallable, Category = "mod.io|UGC|Events|Mod Enabled State Provider")
+	void RemoveModEnabledStatesChangeHandler(const FModEnabledStatesChangeHandler& Handler);
+
+	/**
+	 * Gets the default file the state is persisted to
+	 */
+	static FString GetDefaultStateFilePath();
+
+	//~ Begin UObject Interface
+	virtual void BeginDestroy() override;
+	//~ End UObject Interface
+
+protected:
+	//~ Begin IModEnabledStateProvider Interface
+	virtual bool NativeQueryIsModEnabled(FGenericModID ModID) override;
+	virtual bool NativeRequestModEnabledStateChange(FGenericModID ID, bool bNewEnabledState) override;
+	virtual TArray<FModEnabledStateChange> NativeRequestModEnabledStateChanges(
+		const TMap<FGenericModID, bool>& NewStates) override;
+	//~ End IModEnabledStateProvider Interface
+
+private:
+	/**
+	 * State file writes shared with the worker thread writing them
+	 */
+	struct FPendingWrite
+	{
+		FCriticalSection Lock;
+		TArray<uint8> Data;
+		FString FilePath;
+		bool bHasData = false;
+		bool bWriterRunning = false;
+	};
+
+	void EnsureStateLoaded();
+
+	/**
+	 * Ends a transaction. Once the outermost transaction ends, gets the mods whose state changed in it
+	 * @param bBroadcast Whether to broadcast the changes as well
+	 * @return The changes of the outermost transaction, empty while a transaction is still open
+	 */
+	TArray<FModEnabledStateChange> CommitTransaction_Internal(bool bBroadcast);
+	void SetModEnabled_Internal(FGenericModID ModID, bool bEnabled);
+	void ScheduleWrite();
+	static void WritePendingData(const TSharedRef<FPendingWrite, ESPMode::ThreadSafe>& PendingWrite);
+
+	/** Mods explicitly enabled or disabled. Mods not in the map use bEnabledByDefault */
+	TMap<FGenericModID, bool> ModEnabledStates;
+
+	/** State of the mods changed in the open transaction before their first change */
+	TMap<FGenericModID, bool> TransactionOriginalStates;
+
+	int32 TransactionDepth = 0;
+
+	bool bStateLoaded = false;
+
+	/** File the state is persisted to */
+	FString StateFilePath;
+
+	TSharedRef<FPendingWrite, ESPMode::ThreadSafe> PendingWrite = MakeShared<FPendingWrite, ESPMode::ThreadSafe>();
+
+	/** Latest worker task writing the state file */
+	TFuture<void> WriteTask;
+
+	UPROPERTY()
+	FOnModEnabledStatesChangeMulticastDelegate OnModEnabledStatesChanged;
+};
@@ -15,14 +15,20 @@
 
 #include "SideLoadUGCProvider.generated.h"
 
+class FSideLoadUGCScanner;
+
 /**
- *
+ * UGC provider for UGC placed directly on disk. Every folder under the side-load roots configured in the UGC settings
+ * is a UGC path, with a mod ID read from its mod ID file or parsed from its name
  */
 UCLASS()
 class MODIOUGC_API USideLoadUGCProvider : public UObject, public IUGCProvider
 {
 	GENERATED_BODY()
 
+public:
+	USideLoadUGCProvider();
+
 protected:
 	//~ Begin IUGCProvider Interface
 	virtual void InitializeProvider_Implementation(const FOnUGCProviderInitializedDelegate& Handler) override;
@@ -30,4 +36,18 @@ protected:
 	virtual bool IsProviderEnabled_Implementation() override;
 	virtual FModUGCPathMap GetInstalledUGCPaths_Implementation() override;
 	//~ End IUGCProvider Interface
+
+public:
+	//~ Begin IUGCProvider Interface
+	virtual void GetInstalledUGCPathsAsync(FOnUGCPathsBatchDelegate OnBatch) override;
+	//~ End IUGCProvider Interface
+
+	/**
+	 * Gets the absolute side-load roots from the UGC settings, in priority order
+	 */
+	static TArray<FString> GetSideLoadRoots();
+
+private:
+	/** Shared with asynchronous scans, which may outlive the provider */
+	TSharedPtr<FSideLoadUGCScanner, ESPMode::ThreadSafe> Scanner;
 };
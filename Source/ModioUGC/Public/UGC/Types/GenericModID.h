@@ -37,6 +37,11 @@ struct MODIOUGC_API FGenericModID
 	 **/
 	friend uint32 GetTypeHash(const FGenericModID& ModId);
 
+	/**
+	 * Serializes the ModID to or from an archive, e.g. to persist per-mod state
+	 **/
+	friend MODIOUGC_API FArchive& operator<<(FArchive& Ar, FGenericModID& ModId);
+
 	bool operator==(const FGenericModID& Other) const
 	{
 		return ModID == Other.ModID;
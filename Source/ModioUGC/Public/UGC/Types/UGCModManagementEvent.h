@@ -0,0 +1,36 @@
+/*
+ *  Copyright (C) 2025-2026 mod.io Pty Ltd. <https://mod.io>
+ *
+ *  This file is part of the mod.io ModioUGC Plugin.
+ *
+ *  Distributed under the MIT License. (See accompanying file LICENSE or
+ *   view online at <https://github.com/modio/modio-ue-modiougc/blob/main/LICENSE>)
+ *
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "UGCModManagementEvent.generated.h"
+
+/**
+ * Step of installing, updating or uninstalling a mod, reported by UGC providers that manage mod installations so the
+ * UGC subsystem can mount and unmount the UGC of the mod. Mirrors the mod.io mod management events
+ */
+UENUM(BlueprintType)
+enum class EUGCModManagementEvent : uint8
+{
+	/** The mod is about to be downloaded and installed */
+	BeginInstall,
+	/** The mod was installed, or failed to install */
+	Installed,
+	/** The installed files of the mod are about to be replaced */
+	BeginUpdate,
+	/** The mod was updated, or failed to update and kept its previous version */
+	Updated,
+	/** The installed files of the mod are about to be deleted */
+	BeginUninstall,
+	/** The mod was uninstalled */
+	Uninstalled
+};
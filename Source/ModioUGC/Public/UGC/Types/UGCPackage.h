@@ -16,6 +16,7 @@
 #include "UGCPackage.generated.h"
 
 struct FStreamableHandle;
+class FUGCFileIndex;
 class IPlugin;
 class FPakPlatformFile;
 
@@ -23,7 +24,9 @@ UENUM(BlueprintType)
 enum class EUGCPackageMountState : uint8
 {
 	EUPMS_Unmounted,
-	EUPMS_Mounted
+	EUPMS_Mounted,
+	/** Pak files and asset registry stay resident, but the package is withdrawn from the Asset Manager and queries */
+	EUPMS_Hidden
 };
 
 /**
@@ -38,82 +41,112 @@ public:
 	FScopedPlatformPakFileOverride();
 	~FScopedPlatformPakFileOverride();
 	bool IsValid() const;
+	FPakPlatformFile* Get() const;
 	FPakPlatformFile* operator->() const;
 };
 
 /**
- * Structure containing data associated with this package
+ * Immutable description of a UGC package, derived from its plugin when the package is created. Info objects are
+ * interned per plugin and mod ID, so every copy of a package (and every package created again for the same plugin)
+ * shares a single instance.
  */
-USTRUCT(BlueprintType)
-struct MODIOUGC_API FUGCPackage
+struct MODIOUGC_API FUGCPackageInfo
 {
-	GENERATED_BODY()
-
-	/**
-	 * Information about this asset to register to the Asset Manager for discovery
-	 */
-	UPROPERTY()
-	TWeakObjectPtr<UUGC_Metadata> PackageMetadata;
-
 	/**
 	 * Path to the descriptor file for the UGC package (e.g., "Folder/Subfolder/RedSpaceship.uplugin").
 	 */
-	UPROPERTY()
-	FString DescriptorPath;
+	FName DescriptorPath;
 
 	/**
 	 * Path to the UGC package itself (e.g., "/RedSpaceship").
 	 */
-	UPROPERTY(BlueprintReadOnly, Category = "mod.io|UGCPackage")
-	FString PackagePath;
+	FName PackagePath;
 
 	/**
 	 * Path to the Content directory within the package path (e.g., "/RedSpaceship/Content").
 	 */
-	UPROPERTY(BlueprintReadOnly, Category = "mod.io|UGCPackage")
 	FString ContentPath;
 
 	/**
 	 * Engine version the UGC package was built for. Can be empty.
 	 */
-	UPROPERTY(BlueprintReadOnly, Category = "mod.io|UGCPackage")
 	FString EngineVersion;
 
 	/**
 	 * Author of the UGC package. Can be empty.
 	 */
-	UPROPERTY(BlueprintReadOnly, Category = "mod.io|UGCPackage")
 	FString Author;
 
 	/**
 	 * Description of the UGC package. Can be empty.
 	 */
-	UPROPERTY(BlueprintReadOnly, Category = "mod.io|UGCPackage")
 	FString Description;
 
 	/**
 	 * Friendly name of the UGC package (e.g., "RedSpaceship").
 	 */
-	UPROPERTY(BlueprintReadOnly, Category = "mod.io|UGCPackage")
 	FString FriendlyName;
 
+	/**
+	 * Plugin associated with the UGC package.
+	 */
+	TSharedPtr<IPlugin> AssociatedPlugin;
+
+	/**
+	 * Mod ID associated with the UGC package. Can be empty.
+	 */
+	TOptional<FGenericModID> ModID;
+
+	/**
+	 * Gets the shared info for a plugin, creating it if no live package references one for this plugin and mod ID
+	 */
+	static TSharedRef<const FUGCPackageInfo> Intern(const TSharedRef<IPlugin>& Plugin, TOptional<FGenericModID> ModID);
+
+	/**
+	 * Gets the shared info used by default constructed packages
+	 */
+	static const TSharedRef<const FUGCPackageInfo>& GetEmpty();
+};
+
+/**
+ * Mutable state of a UGC package. Shared between all copies of a package, so a copy taken from the registry observes
+ * the package being unmounted or unloaded.
+ */
+struct MODIOUGC_API FUGCPackageState
+{
 	/**
 	 * Mounted pak file paths for the UGC package. Used to keep track of mounted pak files for the package, such as to
 	 * unmount them when the package is removed.
 	 */
-	UPROPERTY(BlueprintReadOnly, Category = "mod.io|UGCPackage")
 	TArray<FString> MountedPakFilePaths;
 
+	/**
+	 * Serialized index size of the pak files mounted for the package and their IoStore tables of contents, read once
+	 * when the paks are mounted. Used as the estimate of the pak index memory in memory reports.
+	 */
+	int64 PakIndexBytes = 0;
+
+	/**
+	 * Memory used by the pak indices, file index and asset registry of the package, computed once when it is mounted.
+	 * Used by the residency manager to check its budget without building a memory report.
+	 */
+	int64 MountedFootprintBytes = 0;
+
+	/**
+	 * Load priority of the UGC package. Packages with a higher priority are mounted first and their pak files take
+	 * precedence over those of lower priority packages when several packages ship the same file.
+	 */
+	int32 LoadPriority = 0;
+
 	/**
 	 * Mount state of the UGC package.
 	 */
-	UPROPERTY(BlueprintReadOnly, Category = "mod.io|UGCPackage")
 	EUGCPackageMountState MountState = EUGCPackageMountState::EUPMS_Unmounted;
 
 	/**
-	 * Plugin associated with the UGC package.
+	 * Information about this asset to register to the Asset Manager for discovery
 	 */
-	TSharedPtr<IPlugin> AssociatedPlugin;
+	TWeakObjectPtr<UUGC_Metadata> PackageMetadata;
 
 	/**
 	 * Asset registry state for the UGC package. Used to get asset data for the package.
@@ -121,31 +154,180 @@ struct MODIOUGC_API FUGCPackage
 	TSharedPtr<class FAssetRegistryState> LoadedAssetRegistryState;
 
 	/**
-	 * Mod ID associated with the UGC package. Can be empty.
+	 * Package names outside the mount root of the UGC package that were already registered when it was mounted, such
+	 * as base game packages it replaces
 	 */
-	TOptional<FGenericModID> ModID;
+	TArray<FName> ShadowedPackageNames;
+
+	/**
+	 * Index of the files in the mounted pak files of the UGC package, built once when the paks are mounted
+	 */
+	TSharedPtr<const FUGCFileIndex> FileIndex;
+
+	/**
+	 * Handle keeping the metadata load request alive
+	 */
+	TSharedPtr<FStreamableHandle> MetadataDataHandle;
+};
+
+/**
+ * Handle to a UGC package. Copies are cheap: the immutable package info is interned and the mutable state is shared
+ * between copies. Blueprint access to the package data goes through UUGCLibrary.
+ */
+USTRUCT(BlueprintType)
+struct MODIOUGC_API FUGCPackage
+{
+	GENERATED_BODY()
+
+	/**
+	 * Pak read order used for UGC packages with the default load priority. Matches the read order of the base game
+	 * content paks.
+	 */
+	static constexpr int32 DefaultPakReadOrder = 4;
+
+	FUGCPackage();
+
+	/**
+	 * Mounts the pak files of a UGC plugin and loads its assets. With bDeferLoadAssets, only the pak files are mounted
+	 * and the package stays unmounted until FinishMount is called, so that the asset registries of several packages can
+	 * be loaded in parallel with PreloadAssetRegistry in between.
+	 */
+	FUGCPackage(const TSharedRef<IPlugin> Plugin, TOptional<FGenericModID> ModID = {}, int32 InLoadPriority = 0,
+				bool bDeferLoadAssets = false);
 
-	FUGCPackage() {}
-	FUGCPackage(const TSharedRef<IPlugin> Plugin, TOptional<FGenericModID> ModID = {});
+	/**
+	 * Gets the immutable description of the package
+	 */
+	const FUGCPackageInfo& GetInfo() const
+	{
+		return *Info;
+	}
+
+	/**
+	 * Gets the mutable state of the package
+	 */
+	const FUGCPackageState& GetState() const
+	{
+		return *State;
+	}
+
+	const TOptional<FGenericModID>& GetModID() const
+	{
+		return Info->ModID;
+	}
+
+	const TSharedPtr<IPlugin>& GetAssociatedPlugin() const
+	{
+		return Info->AssociatedPlugin;
+	}
+
+	const FString& GetFriendlyName() const
+	{
+		return Info->FriendlyName;
+	}
+
+	EUGCPackageMountState GetMountState() const
+	{
+		return State->MountState;
+	}
+
+	/**
+	 * Gets the read order the pak files of this package are mounted with, derived from the load priority
+	 */
+	uint32 GetPakReadOrder() const;
+
+	/**
+	 * Strict weak ordering of packages by load order: higher priority first, then by descriptor path so that packages
+	 * with equal priority are always mounted in the same order
+	 */
+	static bool LoadOrderPredicate(const FUGCPackage& A, const FUGCPackage& B);
+
+	/**
+	 * Same ordering as above for packages that are not created yet, such as plugins waiting to be mounted
+	 */
+	static bool LoadOrderPredicate(int32 LoadPriorityA, FName DescriptorPathA, int32 LoadPriorityB,
+								   FName DescriptorPathB);
+
+	/**
+	 * Mounts pak files at a mount point, one at a time and from the calling thread, since mounting a pak broadcasts the
+	 * pak mounted delegates. With bPreloadInParallel the footers and indices of the paks are first read and validated
+	 * on worker threads, so that mounting reads them from the file cache, and paks without a valid index are skipped.
+	 *
+	 * @param OutMounted Whether each pak was mounted
+	 * @param OutPakIndexSizes Serialized index size of each mounted pak plus the size of its IoStore table of contents
+	 */
+	static void MountPakFilesInOrder(FPakPlatformFile* PakPlatformFile, const TArray<FString>& PakPaths,
+									 const FString& MountPoint, uint32 PakReadOrder, bool bPreloadInParallel,
+									 TArray<bool>& OutMounted, TArray<int64>& OutPakIndexSizes);
 
 	bool operator==(const FUGCPackage& Other) const;
 	bool operator!=(const FUGCPackage& Other) const;
 
 	friend uint32 GetTypeHash(const FUGCPackage& Key)
 	{
-		return HashCombine(GetTypeHash(Key.ModID.Get(FGenericModID())), GetTypeHash(Key.AssociatedPlugin));
+		return HashCombine(GetTypeHash(Key.Info->ModID.Get(FGenericModID())), GetTypeHash(Key.Info->AssociatedPlugin));
 	}
 
 	bool UnloadAssets();
 
+	/**
+	 * Loads the asset registry of a package whose pak files are mounted but whose assets are not loaded yet. Only
+	 * touches the state of this package, so it can be called from any thread for different packages at once
+	 */
+	void PreloadAssetRegistry();
+
+	/**
+	 * Loads the assets of a package constructed with bDeferLoadAssets, using the asset registry preloaded for it if any
+	 * @return true if the package is now mounted
+	 */
+	bool FinishMount();
+
 private:
-	TSharedPtr<FStreamableHandle> MetadataDataHandle;
+	friend class UUGCSubsystem;
+
+	TSharedRef<const FUGCPackageInfo> Info;
+	TSharedRef<FUGCPackageState> State;
+
+	/**
+	 * Gets the mutable state of the package. The state is shared with every copy of the package
+	 */
+	FUGCPackageState& GetMutableState() const
+	{
+		return *State;
+	}
+
+	/**
+	 * Verify the integrity of the pak files of the UGC package against their stored digests, when enabled in the
+	 * settings.
+	 * @return true if the pak files can be mounted
+	 */
+	bool VerifyPakFiles(const TArray<FString>& PakPaths) const;
+
+	/**
+	 * Mount the pak files of the UGC package, preloading their indices in parallel when enabled in the settings.
+	 * Successfully mounted paks are added to MountedPakFilePaths in the order they were provided, and the files they
+	 * contain to the FileIndex.
+	 * A file index retained from a previous mount of the same paks is used as-is instead of capturing a new one.
+	 */
+	void MountPakFiles(FPakPlatformFile* PakPlatformFile, const TArray<FString>& PakPaths, const FString& MountPoint,
+					   TSharedPtr<const FUGCFileIndex> RetainedFileIndex = nullptr);
+
+	/**
+	 * Gets the path of the asset registry the pak files of the UGC package are cooked with
+	 */
+	FString GetAssetRegistryFilePath() const;
 
 	/**
 	 * Perform all load operations for assets in the UGC package
 	 */
 	bool LoadAssets();
 
+	/**
+	 * Find the packages of the asset registry of the UGC package that replace already registered packages. Must be
+	 * called before the registry state is appended to the global asset registry.
+	 */
+	void FindShadowedPackages();
+
 	/**
 	 * Register the primary assets of the UGC package to the AssetManager.
 	 */
@@ -168,8 +350,22 @@ private:
 
 	/**
 	 * Unregister the primary assets of the UGC package from the AssetManager.
+	 * @param bReleaseResidentData Whether to also release the metadata and the loaded asset registry state. Hidden
+	 * packages keep them so they can be shown again without reloading
+	 */
+	bool UnregisterPrimaryAssets(bool bReleaseResidentData = true);
+
+	/**
+	 * Withdraw the primary asset scan paths of a mounted UGC package while keeping its content resident.
+	 * @return true if the package is now hidden
+	 */
+	bool Hide();
+
+	/**
+	 * Register the primary asset scan paths of a hidden UGC package again.
+	 * @return true if the package is now mounted and visible
 	 */
-	bool UnregisterPrimaryAssets();
+	bool Show();
 
 	/**
 	 * Unload the shader library for the UGC package. This is relevant when the material shader code is shared.
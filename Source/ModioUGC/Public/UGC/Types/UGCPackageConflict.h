@@ -0,0 +1,62 @@
+/*
+ *  Copyright (C) 2025-2026 mod.io Pty Ltd. <https://mod.io>
+ *
+ *  This file is part of the mod.io ModioUGC Plugin.
+ *
+ *  Distributed under the MIT License. (See accompanying file LICENSE or
+ *   view online at <https://github.com/modio/modio-ue-modiougc/blob/main/LICENSE>)
+ *
+ */
+
+#pragma once
+
+#include "UGC/Types/UGCPackage.h"
+
+#include "UGCPackageConflict.generated.h"
+
+/**
+ * Paths shipped by a UGC package that are also provided by another UGC package or by the base game. Which copy is
+ * loaded depends on the pak read order of the packages.
+ */
+USTRUCT(BlueprintType)
+struct MODIOUGC_API FUGCPackageConflict
+{
+	GENERATED_BODY()
+
+	/**
+	 * Package taking precedence in the conflict: the one with the higher load priority, or the UGC package when it
+	 * shadows the base game
+	 */
+	UPROPERTY(BlueprintReadOnly, Category = "mod.io|UGCPackage")
+	FUGCPackage Package;
+
+	/**
+	 * Other package in the conflict. Only meaningful if bShadowsBaseGame is false
+	 */
+	UPROPERTY(BlueprintReadOnly, Category = "mod.io|UGCPackage")
+	FUGCPackage OtherPackage;
+
+	/**
+	 * Whether Package replaces packages of the base game rather than conflicting with another UGC package
+	 */
+	UPROPERTY(BlueprintReadOnly, Category = "mod.io|UGCPackage")
+	bool bShadowsBaseGame = false;
+
+	/**
+	 * Number of package names (e.g. "/Game/Maps/Arena") provided by both sides
+	 */
+	UPROPERTY(BlueprintReadOnly, Category = "mod.io|UGCPackage")
+	int32 NumConflictingPackages = 0;
+
+	/**
+	 * Number of pak file paths provided by both sides
+	 */
+	UPROPERTY(BlueprintReadOnly, Category = "mod.io|UGCPackage")
+	int32 NumConflictingFiles = 0;
+
+	/**
+	 * First few conflicting package names or file paths, for reporting
+	 */
+	UPROPERTY(BlueprintReadOnly, Category = "mod.io|UGCPackage")
+	TArray<FString> ExampleConflictingPaths;
+};
@@ -0,0 +1,59 @@
+/*
+ *  Copyright (C) 2025-2026 mod.io Pty Ltd. <https://mod.io>
+ *
+ *  This file is part of the mod.io ModioUGC Plugin.
+ *
+ *  Distributed under the MIT License. (See accompanying file LICENSE or
+ *   view online at <https://github.com/modio/modio-ue-modiougc/blob/main/LICENSE>)
+ *
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "UGCPackageDependencyIssue.generated.h"
+
+/**
+ * Reason a UGC package cannot be mounted because of its declared dependencies
+ */
+UENUM(BlueprintType)
+enum class EUGCPackageDependencyIssueType : uint8
+{
+	/** A required plugin is neither installed UGC nor an enabled plugin of the project */
+	MissingDependency,
+	/** The package is part of a dependency cycle */
+	DependencyCycle,
+	/** A dependency of the package cannot be mounted */
+	BlockedByDependency
+};
+
+/**
+ * A UGC package whose declared dependencies ("Plugins" in its .uplugin) prevent it from being mounted
+ */
+USTRUCT(BlueprintType)
+struct MODIOUGC_API FUGCPackageDependencyIssue
+{
+	GENERATED_BODY()
+
+	/**
+	 * Name of the plugin of the package
+	 */
+	UPROPERTY(BlueprintReadOnly, Category = "mod.io|UGCPackage")
+	FString PluginName;
+
+	/**
+	 * Path to the .uplugin of the package
+	 */
+	UPROPERTY(BlueprintReadOnly, Category = "mod.io|UGCPackage")
+	FString DescriptorPath;
+
+	UPROPERTY(BlueprintReadOnly, Category = "mod.io|UGCPackage")
+	EUGCPackageDependencyIssueType IssueType = EUGCPackageDependencyIssueType::MissingDependency;
+
+	/**
+	 * The missing dependencies, the plugins of the cycle, or the dependencies that cannot be mounted
+	 */
+	UPROPERTY(BlueprintReadOnly, Category = "mod.io|UGCPackage")
+	TArray<FString> Dependencies;
+};
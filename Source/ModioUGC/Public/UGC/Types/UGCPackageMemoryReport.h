@@ -0,0 +1,100 @@
+/*
+ *  Copyright (C) 2025-2026 mod.io Pty Ltd. <https://mod.io>
+ *
+ *  This file is part of the mod.io ModioUGC Plugin.
+ *
+ *  Distributed under the MIT License. (See accompanying file LICENSE or
+ *   view online at <https://github.com/modio/modio-ue-modiougc/blob/main/LICENSE>)
+ *
+ */
+
+#pragma once
+
+#include "UGC/Types/UGCPackage.h"
+
+#include "UGCPackageMemoryReport.generated.h"
+
+/**
+ * Breakdown of the memory used by a UGC package. Engine structures that do not expose their size are estimated from
+ * their serialized size, so the figures are meant for budgeting rather than exact accounting.
+ */
+USTRUCT(BlueprintType)
+struct MODIOUGC_API FUGCPackageMemoryReport
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "mod.io|UGCPackage")
+	FUGCPackage Package;
+
+	/**
+	 * Pak indices and directory structures of the mounted pak files, estimated when the paks were mounted from the
+	 * serialized index size of each pak and the size of its IoStore table of contents
+	 */
+	UPROPERTY(BlueprintReadOnly, Category = "mod.io|UGCPackage")
+	int64 PakIndexBytes = 0;
+
+	/**
+	 * File index built when the package was mounted
+	 */
+	UPROPERTY(BlueprintReadOnly, Category = "mod.io|UGCPackage")
+	int64 FileIndexBytes = 0;
+
+	/**
+	 * Asset registry state loaded from the package
+	 */
+	UPROPERTY(BlueprintReadOnly, Category = "mod.io|UGCPackage")
+	int64 LoadedAssetRegistryBytes = 0;
+
+	/**
+	 * Share of the global asset registry taken by the entries appended from the loaded asset registry state. The
+	 * global registry keeps its own copy of the asset data, tags and dependencies, estimated from the size of the
+	 * loaded state. Not included in TotalBytes, see TotalUpperBoundBytes
+	 */
+	UPROPERTY(BlueprintReadOnly, Category = "mod.io|UGCPackage")
+	int64 GlobalAssetRegistryBytes = 0;
+
+	/**
+	 * Size of the shader archives of the package. Shader code is read on demand, so this is an upper bound of the
+	 * library tables kept while the library is open and is not included in TotalBytes
+	 */
+	UPROPERTY(BlueprintReadOnly, Category = "mod.io|UGCPackage")
+	int64 ShaderArchiveBytes = 0;
+
+	/**
+	 * Whether the shader library of the package is open
+	 */
+	UPROPERTY(BlueprintReadOnly, Category = "mod.io|UGCPackage")
+	bool bShaderLibraryOpen = false;
+
+	/**
+	 * Number of loaded packages attributed to the UGC package, except for its metadata package which stays loaded while
+	 * the UGC package is mounted
+	 */
+	UPROPERTY(BlueprintReadOnly, Category = "mod.io|UGCPackage")
+	int32 NumResidentPackages = 0;
+
+	/**
+	 * Number of objects in the loaded packages, including the metadata package
+	 */
+	UPROPERTY(BlueprintReadOnly, Category = "mod.io|UGCPackage")
+	int32 NumResidentObjects = 0;
+
+	/**
+	 * Exclusive resource size of the objects in the loaded packages
+	 */
+	UPROPERTY(BlueprintReadOnly, Category = "mod.io|UGCPackage")
+	int64 ResidentObjectBytes = 0;
+
+	/**
+	 * Sum of the pak indices, file index, loaded asset registry state and resident objects. The global asset registry
+	 * share and the shader archives are estimates and are left out, see TotalUpperBoundBytes
+	 */
+	UPROPERTY(BlueprintReadOnly, Category = "mod.io|UGCPackage")
+	int64 TotalBytes = 0;
+
+	/**
+	 * TotalBytes plus the global asset registry share and, while the shader library is open, the shader archive size
+	 */
+	UPROPERTY(BlueprintReadOnly, Category = "mod.io|UGCPackage")
+	int64 TotalUpperBoundBytes = 0;
+};
@@ -12,11 +12,10 @@
 
 #include "Kismet/BlueprintFunctionLibrary.h"
 #include "UGC/Types/GenericModID.h"
+#include "UGC/Types/UGCPackage.h"
 
 #include "UGCLibrary.generated.h"
 
-struct FUGCPackage;
-
 /**
  * Function library for UGC-related functions
  */
@@ -30,6 +29,53 @@ public:
 			  Category = "mod.io|UGC")
 	static bool GetModID(const FUGCPackage& UGCPackage, FGenericModID& ModID);
 
+	/** Returns the path to the UGC package itself (e.g., "/RedSpaceship") */
+	UFUNCTION(BlueprintPure, meta = (DisplayName = "GetPackagePath (FUGCPackage)", CompactNodeTitle = "PackagePath"),
+			  Category = "mod.io|UGCPackage")
+	static FString GetPackagePath(const FUGCPackage& UGCPackage);
+
+	/** Returns the path to the Content directory within the package path (e.g., "/RedSpaceship/Content") */
+	UFUNCTION(BlueprintPure, meta = (DisplayName = "GetContentPath (FUGCPackage)", CompactNodeTitle = "ContentPath"),
+			  Category = "mod.io|UGCPackage")
+	static FString GetContentPath(const FUGCPackage& UGCPackage);
+
+	/** Returns the engine version the UGC package was built for. Can be empty */
+	UFUNCTION(BlueprintPure,
+			  meta = (DisplayName = "GetEngineVersion (FUGCPackage)", CompactNodeTitle = "EngineVersion"),
+			  Category = "mod.io|UGCPackage")
+	static FString GetEngineVersion(const FUGCPackage& UGCPackage);
+
+	/** Returns the author of the UGC package. Can be empty */
+	UFUNCTION(BlueprintPure, meta = (DisplayName = "GetAuthor (FUGCPackage)", CompactNodeTitle = "Author"),
+			  Category = "mod.io|UGCPackage")
+	static FString GetAuthor(const FUGCPackage& UGCPackage);
+
+	/** Returns the description of the UGC package. Can be empty */
+	UFUNCTION(BlueprintPure, meta = (DisplayName = "GetDescription (FUGCPackage)", CompactNodeTitle = "Description"),
+			  Category = "mod.io|UGCPackage")
+	static FString GetDescription(const FUGCPackage& UGCPackage);
+
+	/** Returns the friendly name of the UGC package (e.g., "RedSpaceship") */
+	UFUNCTION(BlueprintPure, meta = (DisplayName = "GetFriendlyName (FUGCPackage)", CompactNodeTitle = "FriendlyName"),
+			  Category = "mod.io|UGCPackage")
+	static FString GetFriendlyName(const FUGCPackage& UGCPackage);
+
+	/** Returns the pak files currently mounted for the UGC package */
+	UFUNCTION(BlueprintPure,
+			  meta = (DisplayName = "GetMountedPakFilePaths (FUGCPackage)", CompactNodeTitle = "MountedPakFilePaths"),
+			  Category = "mod.io|UGCPackage")
+	static TArray<FString> GetMountedPakFilePaths(const FUGCPackage& UGCPackage);
+
+	/** Returns the load priority of the UGC package. Higher priority packages override lower priority ones */
+	UFUNCTION(BlueprintPure, meta = (DisplayName = "GetLoadPriority (FUGCPackage)", CompactNodeTitle = "LoadPriority"),
+			  Category = "mod.io|UGCPackage")
+	static int32 GetLoadPriority(const FUGCPackage& UGCPackage);
+
+	/** Returns the mount state of the UGC package */
+	UFUNCTION(BlueprintPure, meta = (DisplayName = "GetMountState (FUGCPackage)", CompactNodeTitle = "MountState"),
+			  Category = "mod.io|UGCPackage")
+	static EUGCPackageMountState GetMountState(const FUGCPackage& UGCPackage);
+
 	/** Returns true if GenericModID A is equal to GenericModID B (A == B) */
 	UFUNCTION(BlueprintPure,
 			  meta = (DisplayName = "Equal (GenericModID)", CompactNodeTitle = "==", ScriptMethod = "Equals",
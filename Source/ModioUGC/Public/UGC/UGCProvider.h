@@ -10,6 +10,7 @@
 
 #pragma once
 
+#include "Async/Future.h"
 #include "CoreMinimal.h"
 #include "Templates/UnrealTemplate.h"
 #include "Types/GenericModID.h"
@@ -82,6 +83,9 @@ DECLARE_DYNAMIC_DELEGATE_OneParam(FOnUGCProviderInitializedDelegate, bool, bSucc
 // Delegate for UGC provider deinitialization result
 DECLARE_DYNAMIC_DELEGATE_OneParam(FOnUGCProviderDeinitializedDelegate, bool, bSuccess);
 
+// Delegate receiving the installed UGC paths found since the previous batch, bIsFinalBatch is set on the last batch
+DECLARE_DELEGATE_TwoParams(FOnUGCPathsBatchDelegate, const FModUGCPathMap& /*Batch*/, bool /*bIsFinalBatch*/);
+
 UINTERFACE(Blueprintable)
 class MODIOUGC_API UUGCProvider : public UInterface
 {
@@ -125,4 +129,52 @@ public:
 	UFUNCTION(BlueprintCallable, BlueprintNativeEvent, meta = (DisplayName = "Get Installed UGC Paths"),
 			  Category = "mod.io|UGC|Provider")
 	FModUGCPathMap GetInstalledUGCPaths();
+
+	/**
+	 * Gets the load priority for installed UGC. Packages with a higher priority are mounted first and win when several
+	 * packages ship the same file
+	 * @param UGCPath The installed UGC path, as returned by GetInstalledUGCPaths
+	 * @param ModID The mod ID associated with the path. Can be invalid
+	 * @param OutPriority The load priority for the UGC, only valid when this returns true
+	 * @return true if this provider specifies a load priority for the UGC, else false
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintNativeEvent, meta = (DisplayName = "Get UGC Load Priority"),
+			  Category = "mod.io|UGC|Provider")
+	bool GetUGCLoadPriority(const FString& UGCPath, FGenericModID ModID, int32& OutPriority);
+
+	/**
+	 * Notifies the provider that installed UGC failed background verification so that it can repair it, e.g. by
+	 * installing it again. The UGC subsystem does not unmount damaged UGC itself
+	 * @param UGCPath The installed UGC path, as returned by GetInstalledUGCPaths
+	 * @param ModID The mod ID associated with the path. Can be invalid
+	 * @param DamagedFiles The files that failed verification or could not be read
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintNativeEvent, meta = (DisplayName = "Report Damaged UGC"),
+			  Category = "mod.io|UGC|Provider")
+	void ReportDamagedUGC(const FString& UGCPath, FGenericModID ModID, const TArray<FString>& DamagedFiles);
+
+	/**
+	 * Gets the installed UGC paths without blocking the caller. Batches are delivered on the game thread as they are
+	 * found, so mounting can start before the provider has finished enumerating. Providers needing I/O to enumerate
+	 * should override this; the default implementation delivers the result of GetInstalledUGCPaths as a single batch
+	 * @param OnBatch Called for each batch of paths, with bIsFinalBatch set on the last call
+	 */
+	virtual void GetInstalledUGCPathsAsync(FOnUGCPathsBatchDelegate OnBatch);
+
+	/**
+	 * Gets all installed UGC paths without blocking the caller
+	 * @return A future set on the game thread once the last batch of GetInstalledUGCPathsAsync is delivered
+	 */
+	TFuture<FModUGCPathMap> GetAllInstalledUGCPathsAsync();
+
+protected:
+	virtual bool GetUGCLoadPriority_Implementation(const FString& UGCPath, FGenericModID ModID, int32& OutPriority)
+	{
+		return false;
+	}
+
+	virtual void ReportDamagedUGC_Implementation(const FString& UGCPath, FGenericModID ModID,
+												 const TArray<FString>& DamagedFiles)
+	{
+	}
 };
\ No newline at end of file
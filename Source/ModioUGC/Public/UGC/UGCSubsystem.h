@@ -10,14 +10,23 @@
 
 #pragma once
 
+#include "Async/Future.h"
+#include "Containers/Ticker.h"
 #include "Delegates/Delegate.h"
 #include "GameFramework/Actor.h"
 #include "Subsystems/EngineSubsystem.h"
 #include "Templates/SubclassOf.h"
 #include "UGC/IModEnabledStateProvider.h"
 #include "UGC/Types/GenericModID.h"
+#include "UGC/Types/UGCModManagementEvent.h"
 #include "UGC/Types/UGCPackage.h"
+#include "UGC/Types/UGCPackageConflict.h"
+#include "UGC/Types/UGCPackageDependencyIssue.h"
+#include "UGC/Types/UGCPackageMemoryReport.h"
 #include "UGC/Types/UGCSubsystemFeature.h"
+#include "UGC/Utilities/UGCBackgroundVerifier.h"
+#include "UGC/Utilities/UGCConflictIndex.h"
+#include "UGC/Utilities/UGCResidencyTracker.h"
 #include "UGCProvider.h"
 
 #include "UGCSubsystem.generated.h"
@@ -56,7 +65,7 @@ public:
 	void InitializeUGCProvider(const FOnUGCProviderInitializedDelegate& Handler);
 
 	/**
-	 * Completely unloads UGC by mod ID, cleaning up asset registration and mount point
+	 * Completely unloads all UGC of a mod, cleaning up asset registration and mount point
 	 *
 	 * @param ModID Mod ID of the mod to remove UGC for
 	 */
@@ -70,6 +79,17 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "mod.io|UGC")
 	void RefreshUGC();
 
+	/**
+	 * Same as RefreshUGC, but enumerates installed UGC without blocking the game thread when the UGC provider supports
+	 * it. UGC is mounted batch by batch as the provider reports it, emitting a UGCChanged event for each batch that
+	 * mounted UGC. Providers implemented in Blueprint are refreshed synchronously.
+	 * Load order only holds within a batch: a higher priority package reported in a later batch is mounted after the
+	 * packages of earlier batches, although its pak files still take precedence. Packages whose dependencies are
+	 * reported in a later batch are mounted once the last batch has been received
+	 */
+	UFUNCTION(BlueprintCallable, Category = "mod.io|UGC")
+	void RefreshUGCAsync();
+
 	/**
 	 * Gets the UGC package associated with the provided mod ID
 	 *
@@ -97,6 +117,13 @@ public:
 			  Category = "mod.io|UGC")
 	void K2_EnumerateAllUGCPackages(const FUGCPackageEnumeratorDelegate& Enumerator) const;
 
+	/**
+	 * Gets all UGC packages in the registry sorted by load order, highest priority first
+	 *
+	 * @return Array of UGC packages in the order they were mounted
+	 */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Get UGC Packages In Load Order"), Category = "mod.io|UGC")
+	TArray<FUGCPackage> GetUGCPackagesInLoadOrder() const;
 
 	/**
 	 * Checks if a UGC is compatible with the current engine version
@@ -135,6 +162,55 @@ public:
 	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Unload All UGC Packages"), Category = "mod.io|UGC")
 	void UnloadAllUGCPackages();
 
+	/**
+	 * Mounts the UGC installed for a single mod without rescanning or remounting any other UGC. UGC already mounted for
+	 * the mod is unloaded first, so this also picks up updated mods
+	 * Will emit a UGCChanged event if any UGC was mounted
+	 *
+	 * @param ModID ID of the mod to mount UGC for
+	 * @param UGCPath Path the mod is installed at
+	 * @return true if any UGC was mounted for the mod
+	 */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Mount UGC By Mod ID"), Category = "mod.io|UGC")
+	bool MountUGCByModID(FGenericModID ModID, const FString& UGCPath);
+
+	/**
+	 * Mounts or unloads the UGC of a single mod in response to a mod management event of a UGC provider managing mod
+	 * installations. UGC is unloaded, including its loaded assets, before the installed files of the mod are replaced
+	 * or deleted, and mounted once the mod is installed or updated
+	 *
+	 * @param ModID ID of the mod the event is about
+	 * @param Event The mod management event
+	 * @param GetInstalledPath Gets the path the mod is installed at, or an empty string if it is not installed. Only
+	 * called for the events that mount UGC
+	 * @return false if UGC should have been mounted for the mod but none was
+	 */
+	bool HandleModManagementEvent(FGenericModID ModID, EUGCModManagementEvent Event,
+								  TFunctionRef<FString()> GetInstalledPath);
+
+	/**
+	 * Loads the UGC installed for a single mod if it is not loaded yet. Only the plugins under the mod's installed path
+	 * are discovered, validated and mounted, without rescanning the plugin list or iterating every plugin
+	 * Will emit a UGCChanged event if any UGC was mounted
+	 *
+	 * @param ModID ID of the mod to load UGC for, looked up in the installed UGC of the UGC provider
+	 * @return true if UGC for the mod is loaded
+	 */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Load UGC By Mod ID"), Category = "mod.io|UGC")
+	bool LoadUGCByModID(FGenericModID ModID);
+
+	/**
+	 * Refreshes the UGC under a single path: UGC whose .uplugin was removed is unloaded, and plugins added under the
+	 * path are discovered, validated and mounted. Other UGC is neither rescanned nor remounted. New plugins are
+	 * associated with the mod the UGC provider reports as installed at the path, if any
+	 * Will emit a UGCChanged event if any UGC was unloaded or mounted
+	 *
+	 * @param Path The path to refresh, such as "C:\Users\Public\mod.io\6532\mods\4119758"
+	 * @return true if any UGC was mounted
+	 */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Refresh UGC For Path"), Category = "mod.io|UGC")
+	bool RefreshUGCForPath(const FString& Path);
+
 	/**
 	 * Unmounts a UGC Package from the registry based on the provided mod ID
 	 *
@@ -155,6 +231,157 @@ public:
 	void UnmountUGCPackage(UPARAM(ref) FUGCPackage& Package,
 						   UPARAM(DisplayName = "Remove UGC Package") bool bRemoveUGCPackage = false);
 
+	/**
+	 * Hides or shows a mounted UGC package without unmounting it. Hidden packages keep their pak files and asset
+	 * registry resident, but their primary asset scan paths are withdrawn from the Asset Manager and they are excluded
+	 * from EnumerateAllUGCPackages, GetUGCPackagesInLoadOrder, FindUGCPackageForPackageName, FindUGCPackageForObject,
+	 * FileExistsInUGC and FindFilesInUGC. Their assets stay in the global asset registry and can still be loaded by
+	 * path, so hiding only removes a package from discovery. Toggling is much cheaper than unloading and reloading, at
+	 * the memory cost reported by GetUGCPackageResidentSize. Unloading a package resets its hidden state
+	 *
+	 * @param Package The mounted package to hide or show
+	 * @param bHidden Whether the package should be hidden
+	 * @return true if the package is in the requested state
+	 */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Set UGC Package Hidden"), Category = "mod.io|UGC")
+	bool SetUGCPackageHidden(UPARAM(ref) FUGCPackage& Package, bool bHidden);
+
+	/**
+	 * Hides or shows a mounted UGC package by mod ID, see SetUGCPackageHidden
+	 *
+	 * @param ModID The ID of the package to hide or show
+	 * @param bHidden Whether the package should be hidden
+	 * @return true if the package is in the requested state
+	 */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Set UGC Package Hidden By Mod ID"), Category = "mod.io|UGC")
+	bool SetUGCPackageHiddenByModID(FGenericModID ModID, bool bHidden);
+
+	/**
+	 * Gets the memory kept resident by a mounted UGC package for its loaded asset registry, file index and metadata
+	 *
+	 * @param UGCPackage The package to measure
+	 * @return Resident memory in bytes
+	 */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Get UGC Package Resident Size"), Category = "mod.io|UGC")
+	int64 GetUGCPackageResidentSize(const FUGCPackage& UGCPackage) const;
+
+	/**
+	 * Gets the memory kept resident by all hidden UGC packages, see GetUGCPackageResidentSize
+	 *
+	 * @return Resident memory in bytes
+	 */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Get Hidden UGC Packages Resident Size"),
+			  Category = "mod.io|UGC")
+	int64 GetHiddenUGCPackagesResidentSize() const;
+
+	/**
+	 * Gets the memory breakdown of a UGC package: pak indices, file index, loaded and global asset registry, shader
+	 * archives and the objects loaded from it
+	 *
+	 * @param UGCPackage The package to measure
+	 * @return The memory report of the package
+	 */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Get UGC Package Memory Report"),
+			  Category = "mod.io|UGC|Utilities")
+	FUGCPackageMemoryReport GetUGCPackageMemoryReport(const FUGCPackage& UGCPackage) const;
+
+	/**
+	 * Gets the memory breakdown of every registered UGC package, see GetUGCPackageMemoryReport. Loaded objects are
+	 * attributed in a single pass, so this is cheaper than reporting packages one by one
+	 *
+	 * @return The memory reports, largest first
+	 */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Get UGC Memory Report"), Category = "mod.io|UGC|Utilities")
+	TArray<FUGCPackageMemoryReport> GetUGCMemoryReport() const;
+
+	/**
+	 * Logs the memory breakdown of every registered UGC package. Also available as the "ugc.memreport" console command
+	 */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Log UGC Memory Report"), Category = "mod.io|UGC|Utilities")
+	void LogUGCMemoryReport() const;
+
+	/**
+	 * Writes the memory breakdown of every registered UGC package to an output device
+	 */
+	void DumpUGCMemoryReport(FOutputDevice& Ar) const;
+
+	/**
+	 * Pins a UGC package so the residency manager never evicts it, e.g. because the current match needs it. Pins are
+	 * counted and kept across remounts
+	 *
+	 * @param UGCPackage The package to pin
+	 */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Pin UGC Package"), Category = "mod.io|UGC|Residency")
+	void PinUGCPackage(const FUGCPackage& UGCPackage);
+
+	/**
+	 * Releases a pin taken with PinUGCPackage
+	 *
+	 * @param UGCPackage The package to unpin
+	 */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Unpin UGC Package"), Category = "mod.io|UGC|Residency")
+	void UnpinUGCPackage(const FUGCPackage& UGCPackage);
+
+	/**
+	 * Pins a UGC package by mod ID, mounting it again first if it was evicted
+	 *
+	 * @param ModID The ID of the package to pin
+	 * @return true if the package is mounted and pinned
+	 */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Pin UGC Package By Mod ID"), Category = "mod.io|UGC|Residency")
+	bool PinUGCPackageByModID(FGenericModID ModID);
+
+	/**
+	 * Releases a pin taken with PinUGCPackageByModID
+	 *
+	 * @param ModID The ID of the package to unpin
+	 */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Unpin UGC Package By Mod ID"),
+			  Category = "mod.io|UGC|Residency")
+	void UnpinUGCPackageByModID(FGenericModID ModID);
+
+	/**
+	 * Gets the UGC package associated with a mod ID, mounting it again first if it was evicted by the residency
+	 * manager. Loading content from evicted UGC fails, so UGC that may have been evicted has to be made resident with
+	 * this or EnsureUGCPackageResidentForPackageName before its content is loaded
+	 *
+	 * @param ModID The ID of the mod to get the package for
+	 * @param UGCPackage The mounted package
+	 * @return true if the package is mounted
+	 */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Ensure UGC Package Resident By Mod ID"),
+			  Category = "mod.io|UGC|Residency")
+	bool EnsureUGCPackageResidentByModID(FGenericModID ModID, FUGCPackage& UGCPackage);
+
+	/**
+	 * Gets the UGC package providing a package, mounting it again first if it was evicted by the residency manager.
+	 * Call before loading content by path from UGC that may have been evicted, as loads from evicted UGC fail
+	 *
+	 * @param PackageName Name of the package to load, such as "/RedSpaceship/Meshes/Hull"
+	 * @param UGCPackage The mounted package providing it
+	 * @return true if the package providing it is mounted
+	 */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Ensure UGC Package Resident For Package Name"),
+			  Category = "mod.io|UGC|Residency")
+	bool EnsureUGCPackageResidentForPackageName(FName PackageName, FUGCPackage& UGCPackage);
+
+	/**
+	 * Indicates whether the UGC package associated with a mod ID was evicted by the residency manager
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, meta = (DisplayName = "Is UGC Package Evicted By Mod ID"),
+			  Category = "mod.io|UGC|Residency")
+	bool IsUGCPackageEvictedByModID(FGenericModID ModID) const;
+
+	/**
+	 * Evicts the least recently used UGC packages until the mounted packages fit the residency budget. Packages that
+	 * are pinned or have loaded content are never evicted. Called automatically after UGC is mounted when the
+	 * residency manager is enabled. Uses the footprint of each package computed when it was mounted, so it does not
+	 * build a memory report
+	 */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Enforce UGC Residency Budget"),
+			  Category = "mod.io|UGC|Residency")
+	void EnforceUGCResidencyBudget();
+
 	/**
 	 * Registers a delegate to receive callbacks when UGC packages are added or removed from the registry
 	 * @param Handler Delegate to invoke
@@ -171,7 +398,8 @@ public:
 	void RemoveUGCChangedHandler(const FOnUGCPackagesChangedDelegate& Handler);
 
 	/**
-	 * Registers a delegate for notifications when a mod's enabled state changes
+	 * Registers a delegate for notifications when RequestModEnabledStateChange changed a mod's enabled state. Bulk
+	 * changes are only notified through AddModEnabledStatesChangeHandler
 	 * @param Handler Delegate to be notified
 	 */
 	UFUNCTION(BlueprintCallable, Category = "mod.io|UGC|Events|Mod Enabled State Provider")
@@ -184,6 +412,30 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "mod.io|UGC|Events|Mod Enabled State Provider")
 	void RemoveModEnabledStateChangeHandler(const FModEnabledStateChangeHandler& Handler);
 
+	/**
+	 * Registers a delegate for notifications when RequestModEnabledStateChanges changed the state of one or more mods
+	 * @param Handler Delegate to be notified
+	 */
+	UFUNCTION(BlueprintCallable, Category = "mod.io|UGC|Events|Mod Enabled State Provider")
+	void AddModEnabledStatesChangeHandler(const FModEnabledStatesChangeHandler& Handler);
+
+	/**
+	 * Unregisters a delegate for notifications when RequestModEnabledStateChanges changed the state of mods
+	 * @param Handler Delegate to be removed from the notification list
+	 */
+	UFUNCTION(BlueprintCallable, Category = "mod.io|UGC|Events|Mod Enabled State Provider")
+	void RemoveModEnabledStatesChangeHandler(const FModEnabledStatesChangeHandler& Handler);
+
+	/**
+	 * Requests that the enabled state of several mods be changed, e.g. to apply a loadout, with a single bulk call to
+	 * the enabled state provider. Broadcasts one batched change event for all mods whose state changed, and no single
+	 * change events
+	 * @param NewStates The new enabled state of each mod to change
+	 * @return The number of mods whose state changed
+	 */
+	UFUNCTION(BlueprintCallable, Category = "mod.io|UGC|Mod Enabled State Provider")
+	int32 RequestModEnabledStateChanges(const TMap<FGenericModID, bool>& NewStates);
+
 	/**
 	 * Allows the object to query for mod enable/disable state to be set externally
 	 * @param NewProvider The new object to query via IModEnabledStateProvider
@@ -209,10 +461,92 @@ public:
 			  Category = "mod.io|UGC|Utilities")
 	TArray<FName> GetPackageNamesFromUGCPackage(const FUGCPackage& UGCPackage) const;
 
+	/**
+	 * Checks whether a file is contained in the mounted pak files of a UGC package. Uses the file index built when the
+	 * package was mounted, so the pak directory index is not walked
+	 * @param UGCPackage The UGC package to search
+	 * @param FilePath Path of the file as listed by the pak file, prefixed with the mount point. Case insensitive
+	 * @return true if the package contains the file. Always false for hidden packages
+	 */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "File Exists In UGC"), Category = "mod.io|UGC|Utilities")
+	bool FileExistsInUGC(const FUGCPackage& UGCPackage, const FString& FilePath) const;
+
+	/**
+	 * Finds the files in the mounted pak files of a UGC package matching a wildcard
+	 * @param UGCPackage The UGC package to search
+	 * @param Wildcard Pattern using '*' and '?' wildcards, matched against the paths listed by the pak files. The
+	 * literal part before the first wildcard narrows the search
+	 * @return The matching file paths, in case insensitive path order. Empty for hidden packages
+	 */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Find Files In UGC"), Category = "mod.io|UGC|Utilities")
+	TArray<FString> FindFilesInUGC(const FUGCPackage& UGCPackage, const FString& Wildcard) const;
+
+	/**
+	 * Gets the path conflicts between mounted UGC packages, and between UGC packages and the base game. A conflict is
+	 * reported once per package pair
+	 * @return The conflicts, with the package taking precedence first
+	 */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Get UGC Package Conflicts"), Category = "mod.io|UGC|Utilities")
+	TArray<FUGCPackageConflict> GetUGCPackageConflicts() const;
+
+	/**
+	 * Gets the path conflicts a UGC package is involved in
+	 * @param UGCPackage The UGC package to get conflicts for
+	 * @return The conflicts, with the package taking precedence first
+	 */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Get Conflicts For UGC Package"),
+			  Category = "mod.io|UGC|Utilities")
+	TArray<FUGCPackageConflict> GetConflictsForUGCPackage(const FUGCPackage& UGCPackage) const;
+
+	/**
+	 * Gets the UGC packages that were not mounted because of their declared dependencies: missing dependencies,
+	 * dependency cycles, or dependencies that cannot be mounted. Updated by every refresh
+	 * @return The dependency issues found when UGC was last mounted
+	 */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Get UGC Dependency Issues"), Category = "mod.io|UGC|Utilities")
+	TArray<FUGCPackageDependencyIssue> GetUGCDependencyIssues() const;
+
+	/**
+	 * Gets the installed UGC found damaged by the last background verification pass, which has been reported to the
+	 * UGC provider for repair. See bEnableBackgroundUGCVerification in the plugin settings
+	 * @return The installed UGC paths with damaged paks or unreadable asset registries
+	 */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Get Damaged UGC Paths"), Category = "mod.io|UGC|Utilities")
+	TArray<FString> GetDamagedUGCPaths() const;
+
+	/**
+	 * Logs a summary of the path conflicts between mounted UGC packages
+	 */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Log UGC Package Conflicts"), Category = "mod.io|UGC|Utilities")
+	void LogUGCPackageConflicts() const;
+
+	/**
+	 * Finds the UGC package that provides a package, such as "/RedSpaceship/Meshes/Hull". Object paths are accepted as
+	 * well. Packages that are not listed in the asset registry of a UGC package are attributed by their mount root.
+	 * Packages of hidden UGC packages are not attributed
+	 * @param PackageName Name of the package to attribute
+	 * @param UGCPackage The UGC package providing the package, if found
+	 * @return true if the package belongs to a registered UGC package
+	 */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Find UGC Package For Package Name"),
+			  Category = "mod.io|UGC|Utilities")
+	bool FindUGCPackageForPackageName(FName PackageName, FUGCPackage& UGCPackage) const;
+
+	/**
+	 * Finds the UGC package that provides the package an object was loaded from
+	 * @param Object The object to attribute
+	 * @param UGCPackage The UGC package providing the object, if found
+	 * @return true if the object belongs to a registered UGC package
+	 */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Find UGC Package For Object"),
+			  Category = "mod.io|UGC|Utilities")
+	bool FindUGCPackageForObject(const UObject* Object, FUGCPackage& UGCPackage) const;
+
 protected:
 	//~ Begin IModEnabledStateProvider Interface
 	virtual bool NativeQueryIsModEnabled(FGenericModID ModID) override;
 	virtual bool NativeRequestModEnabledStateChange(FGenericModID ID, bool bNewEnabledState) override;
+	virtual bool NativeQueryModLoadPriority(FGenericModID ModID, int32& OutPriority) override;
 	//~ End IModEnabledStateProvider Interface
 
 	UPROPERTY()
@@ -245,14 +579,169 @@ private:
 	 */
 	void UnmountUGCPackage_Internal(FUGCPackage& Package);
 
+	/**
+	 * UnmountUGCPackage without retaining the package for warm remounting, for callers that have already retained it
+	 * before unloading its assets or that cannot remount it
+	 *
+	 * @param Package The package to unmount
+	 * @param bRemoveUGCPackage Whether the package is removed from the registry
+	 */
+	void UnmountAndUnregisterUGCPackage(FUGCPackage& Package, bool bRemoveUGCPackage);
+
+	/**
+	 * Marks the UGC package providing a requested package as used. Evicted packages content is requested from cannot
+	 * be mounted within the request, so the request fails and they are mounted again on the next tick. Bound to the
+	 * package load delegates when the residency manager is enabled
+	 */
+	void OnPackageLoadRequested(const FString& PackageName);
+
+	/**
+	 * Whether any package of a UGC package other than its metadata is loaded
+	 */
+	bool IsUGCPackageInUse(const FUGCPackage& Package) const;
+
+	/**
+	 * Gets the mount root of a package name, such as "/RedSpaceship" for "/RedSpaceship/Meshes/Hull"
+	 */
+	static FName GetMountRoot(const FString& PackageName);
+
+	/**
+	 * Unloads a package to free memory, remembering how to mount it again
+	 */
+	void EvictUGCPackage(FUGCPackage& Package);
+
+	/**
+	 * Mounts a package evicted by the residency manager again
+	 *
+	 * @return true if the package was mounted
+	 */
+	bool RemountEvictedUGC(const FUGCResidencyTracker::FEvictedPackage& EvictedPackage);
+
+	/**
+	 * Builds the memory report of a package, except for its loaded objects
+	 */
+	FUGCPackageMemoryReport BuildMemoryReport(const FUGCPackage& Package) const;
+
+	/**
+	 * Attributes the loaded packages to the memory reports in a single pass, and computes their totals
+	 */
+	void AddResidentObjectsToMemoryReports(TArray<FUGCPackageMemoryReport>& Reports) const;
+
+	/**
+	 * Finds the UGC package providing a package like FindUGCPackageForPackageName, including hidden packages, for
+	 * bookkeeping that must cover every mounted package such as residency and memory reports
+	 */
+	bool AttributePackageName(FName PackageName, FUGCPackage& UGCPackage) const;
+
+	/**
+	 * Adds the package names of a mounted UGC package to the package attribution index
+	 */
+	void AddUGCPackageToAttributionIndex(const FUGCPackage& Package);
+
+	/**
+	 * Removes a UGC package from the package attribution index
+	 */
+	void RemoveUGCPackageFromAttributionIndex(const FUGCPackage& Package);
+
+	/**
+	 * Discovers the UGC plugins under installed UGC paths and loads them in load order
+	 *
+	 * @param UGCPathMap Installed UGC paths and their mod IDs
+	 * @param bIncremental Whether only plugins under these paths are loaded, without rescanning the plugin list. Used
+	 * to mount the batches of an asynchronous refresh
+	 * @param bAssociateModIDs Whether the loaded plugins are associated with the mod IDs of the map. Paths whose mod is
+	 * not known are mounted without associating a mod ID
+	 * @return true if any UGC was loaded
+	 */
+	bool MountUGCPaths(const FModUGCPathMap& UGCPathMap, bool bIncremental, bool bAssociateModIDs = true);
+
+	/**
+	 * Unmounts loaded UGC whose plugin descriptor no longer exists
+	 */
+	void UnmountMissingUGC();
+
+	/**
+	 * Adds the UGC plugins found under a path to the plugin list, like AddUGCFromPath
+	 *
+	 * @param Path The path to search for .uplugin files
+	 * @return The compatible plugins under the path, including those that were already in the plugin list
+	 */
+	TArray<TSharedRef<IPlugin>> AddUGCPluginsFromPath(const FString& Path);
+
+	/**
+	 * Opens the pak files of UGC plugins and reads their indices on worker threads, so that mounting them reads from
+	 * the file cache. Optionally hashes them as well so that their verification at mount time is cached. Only files
+	 * with a stored digest are hashed, as the others are not verified at mount time
+	 *
+	 * @param Plugins The plugins to prepare ahead of mounting
+	 * @param bHashContent Whether the verifiable pak files are hashed
+	 * @return Future completed once every pak file has been read and hashed
+	 */
+	static TFuture<void> PrepareUGCPlugins(TArray<TSharedRef<IPlugin>> Plugins, bool bHashContent);
+
+	/**
+	 * Logs the dependency issues found while resolving mount order and records them for GetUGCDependencyIssues
+	 *
+	 * @param Issues The issues found
+	 * @param ReplacedDescriptorPaths Descriptors of the packages whose previous issues are replaced, or null to replace
+	 * all issues
+	 */
+	void RecordDependencyIssues(const TArray<FUGCPackageDependencyIssue>& Issues,
+								const TArray<FString>* ReplacedDescriptorPaths);
+
+	/**
+	 * Starts background verification passes while the game is idle, and pauses the running pass when it is not
+	 */
+	bool TickBackgroundVerification(float DeltaTime);
+
+	/**
+	 * Gathers the installed UGC paths of the last refresh and the directories of mounted UGC packages outside of them
+	 * to verify in the background
+	 */
+	TArray<FUGCBackgroundVerifier::FTarget> GatherBackgroundVerificationTargets() const;
+
+	/**
+	 * Records the damaged UGC found by a background verification pass and reports it to the UGC provider
+	 */
+	void OnBackgroundVerificationPassComplete(const TArray<FUGCBackgroundVerifier::FDamagedUGC>& DamagedUGC);
+
+	/**
+	 * Resolves the load priority for a UGC plugin. The mod enabled state provider takes precedence, followed by the UGC
+	 * provider and finally the "UGCLoadPriority" field of the plugin descriptor
+	 *
+	 * @param Plugin The plugin to resolve the load priority for
+	 * @param UGCPath The installed UGC path the plugin was discovered under. Can be empty
+	 * @param RawModID Optional raw mod ID associated with the plugin
+	 * @return The load priority, or 0 if nothing specifies one
+	 */
+	int32 ResolveLoadPriority(const TSharedRef<IPlugin>& Plugin, const FString& UGCPath,
+							  TOptional<FGenericModID> RawModID);
+
 	/**
 	 * Loads UGC from a plugin. This performs the necessary steps to load the plugin and add it to the UGC registry,
 	 * allowing to access the UGC package and its assets
 	 *
 	 * @param LoadedPlugin The loaded plugin to load UGC from
 	 * @param RawModID Optional raw mod ID to associate with the UGC package
+	 * @param LoadPriority Load priority of the UGC package, see FUGCPackageState::LoadPriority
+	 */
+	bool LoadUGC(TSharedPtr<IPlugin> LoadedPlugin, TOptional<FGenericModID> RawModID = {}, int32 LoadPriority = 0);
+
+	/**
+	 * First step of LoadUGC: mounts the plugin and the pak files of its UGC package, without loading its assets
+	 *
+	 * @return The package to pass to FinishLoadUGC, or nothing if the plugin is not UGC or is already loaded
+	 */
+	TOptional<FUGCPackage> BeginLoadUGC(TSharedPtr<IPlugin> LoadedPlugin, TOptional<FGenericModID> RawModID,
+										int32 LoadPriority);
+
+	/**
+	 * Second step of LoadUGC: loads the assets of a package returned by BeginLoadUGC and adds it to the UGC registry,
+	 * or unloads it if it fails to mount
+	 *
+	 * @return true if the package was added to the registry
 	 */
-	bool LoadUGC(TSharedPtr<IPlugin> LoadedPlugin, TOptional<FGenericModID> RawModID = {});
+	bool FinishLoadUGC(FUGCPackage& ModPackage);
 
 	/**
 	 * Completely unloads UGC, cleaning up asset registration and mount point
@@ -261,6 +750,19 @@ private:
 	 */
 	bool UnloadUGC(FUGCPackage& Package);
 
+	/**
+	 * Unloads all UGC packages associated with a mod
+	 *
+	 * @param ModID Mod ID of the mod to remove UGC for
+	 * @return true if any UGC was unloaded
+	 */
+	bool UnloadUGCByModID_Internal(FGenericModID ModID);
+
+	/**
+	 * Incremented by every refresh, so batches of a superseded asynchronous refresh are ignored
+	 */
+	uint32 AsyncRefreshSerial = 0;
+
 	/**
 	 * Loaded UGC plugin names
 	 */
@@ -275,6 +777,79 @@ private:
 
 	TMultiMap<FUGCPackage, FName> RegisteredPackagesToPrimaryAssetTypesMap;
 
+	/**
+	 * Package names from the asset registry of each mounted UGC package, mapped to the UGC package providing them
+	 */
+	TMap<FName, FUGCPackage> PackageNameToUGCPackageMap;
+
+	/**
+	 * Package names indexed for each mounted UGC package, so that removing a package only visits its own names
+	 */
+	TMap<FUGCPackage, TArray<FName>> IndexedPackageNames;
+
+	/**
+	 * Every mounted UGC package providing a package name shipped by more than one of them, so that the name is
+	 * attributed to the next provider when the package it is attributed to is removed
+	 */
+	TMap<FName, TArray<FUGCPackage>> SharedPackageNameProviders;
+
+	/**
+	 * Mount roots of mounted UGC packages (e.g. "/RedSpaceship"), used to attribute packages missing from the registry
+	 */
+	TMap<FName, FUGCPackage> MountRootToUGCPackageMap;
+
+	/**
+	 * Package names and pak file paths shipped by more than one mounted package
+	 */
+	FUGCConflictIndex ConflictIndex;
+
+	/**
+	 * Packages left unmounted because of their declared dependencies
+	 */
+	TArray<FUGCPackageDependencyIssue> DependencyIssues;
+
+	/**
+	 * Guards the attribution maps, which can be queried from crash and hitch reporting outside the game thread
+	 */
+	mutable FRWLock PackageAttributionLock;
+
+	/**
+	 * Last use and pins of mounted packages, and evicted packages, for the residency manager
+	 */
+	mutable FUGCResidencyTracker ResidencyTracker;
+
+	/**
+	 * Verifies installed UGC on a lowest priority thread, created on the first background verification pass
+	 */
+	TSharedPtr<FUGCBackgroundVerifier, ESPMode::ThreadSafe> BackgroundVerifier;
+
+	FTSTicker::FDelegateHandle BackgroundVerificationTickHandle;
+
+	/**
+	 * Last time UGC was mounted or packages were loaded asynchronously, to detect when the game is idle
+	 */
+	double LastUGCActivityTime = 0.0;
+
+	/**
+	 * End of the last completed background verification pass
+	 */
+	double LastBackgroundVerificationTime = 0.0;
+	bool bHasCompletedBackgroundVerification = false;
+
+	/**
+	 * Installed UGC paths found damaged by the last background verification pass
+	 */
+	TArray<FString> DamagedUGCPaths;
+
+	/**
+	 * Installed UGC paths enumerated by the last refresh, kept up to date by mod management events. Background
+	 * verification verifies these without querying the UGC provider again
+	 */
+	FModUGCPathMap CachedInstalledUGCPaths;
+
+	FDelegateHandle SyncLoadHandle;
+	FDelegateHandle AsyncLoadHandle;
+
 	/**
 	 * Delegate to invoke when UGC packages are loaded or unloaded
 	 */
@@ -289,11 +864,17 @@ private:
 	TScriptInterface<IModEnabledStateProvider> ModEnabledStateProvider;
 
 	/**
-	 * Delegate to invoke when a mod's enabled state changes
+	 * Delegate to invoke when a single mod's enabled state changes
 	 */
 	UPROPERTY()
 	FOnModEnabledStateChangeMulticastDelegate OnModEnabledStateChanged;
 
+	/**
+	 * Delegate to invoke once per bulk change of mod enabled states
+	 */
+	UPROPERTY()
+	FOnModEnabledStatesChangeMulticastDelegate OnModEnabledStatesChanged;
+
 	/**
 	 * Delegate to invoke when the provided IUGCProvider has been initialized
 	 */
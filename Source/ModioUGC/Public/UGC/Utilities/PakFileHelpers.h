@@ -10,25 +10,10 @@
 
 #pragma once
 
+#include "HAL/FileManager.h"
+#include "IPlatformFilePak.h"
 #include "ModioUGC.h"
 
-class FPakFileContentsIterator final : public IPlatformFile::FDirectoryVisitor
-{
-	FString PakName;
-
-public:
-	explicit FPakFileContentsIterator(const FString& InPakName) : PakName(InPakName)
-	{
-		UE_LOG(LogModioUGC, VeryVerbose, TEXT("Pakfile %s mounted"), *PakName);
-	}
-
-	virtual bool Visit(const TCHAR* FilenameOrDirectory, bool bIsDirectory) override
-	{
-		UE_LOG(LogModioUGC, VeryVerbose, TEXT("Pakfile %s : %s"), *PakName, FilenameOrDirectory);
-		return true;
-	}
-};
-
 class FPakFileSearchVisitor final : public IPlatformFile::FDirectoryVisitor
 {
 	TArray<FString>& FoundFiles;
@@ -47,4 +32,70 @@ public:
 		}
 		return true;
 	}
-};
\ No newline at end of file
+};
+
+/**
+ * Reads the footer of a pak file the same way the pak platform file does: each pak version is tried from the latest
+ * until the footer magic matches. Returns false if the file cannot be read or has no valid footer.
+ */
+inline bool ReadPakFooter(const FString& PakPath, FPakInfo& OutPakInfo, int64& OutPakSize)
+{
+	TUniquePtr<FArchive> Reader(IFileManager::Get().CreateFileReader(*PakPath));
+	if (!Reader)
+	{
+		return false;
+	}
+
+	OutPakSize = Reader->TotalSize();
+	for (int32 Version = FPakInfo::PakFile_Version_Latest; Version >= FPakInfo::PakFile_Version_Initial; --Version)
+	{
+		const int64 InfoSize = OutPakInfo.GetSerializedSize(Version);
+		if (OutPakSize < InfoSize)
+		{
+			continue;
+		}
+		Reader->Seek(OutPakSize - InfoSize);
+		OutPakInfo.Serialize(*Reader, Version);
+		if (!Reader->IsError() && OutPakInfo.Magic == FPakInfo::PakFile_Magic)
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+/**
+ * Reads the footer and the whole index region of a pak file, so that mounting the pak afterwards reads them from the
+ * file cache. The primary index is followed by the path hash and directory indices, then by the footer, so everything
+ * from the index offset to the end of the file is read. Returns false if the pak has no valid footer or its index
+ * cannot be read.
+ */
+inline bool PreloadPakIndex(const FString& PakPath, FPakInfo& OutPakInfo)
+{
+	int64 PakSize = 0;
+	if (!ReadPakFooter(PakPath, OutPakInfo, PakSize))
+	{
+		return false;
+	}
+	if (OutPakInfo.IndexOffset < 0 || OutPakInfo.IndexSize < 0 ||
+		OutPakInfo.IndexOffset + OutPakInfo.IndexSize > PakSize)
+	{
+		return false;
+	}
+
+	TUniquePtr<FArchive> Reader(IFileManager::Get().CreateFileReader(*PakPath));
+	if (!Reader)
+	{
+		return false;
+	}
+
+	constexpr int64 ReadChunkSize = 256 * 1024;
+	TArray<uint8> Buffer;
+	Buffer.SetNumUninitialized(static_cast<int32>(FMath::Min(ReadChunkSize, PakSize - OutPakInfo.IndexOffset)));
+	Reader->Seek(OutPakInfo.IndexOffset);
+	for (int64 Offset = OutPakInfo.IndexOffset; Offset < PakSize && !Reader->IsError(); Offset += ReadChunkSize)
+	{
+		Reader->Serialize(Buffer.GetData(), FMath::Min(ReadChunkSize, PakSize - Offset));
+	}
+	return !Reader->IsError();
+}
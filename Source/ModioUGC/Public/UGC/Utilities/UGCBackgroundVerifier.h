@@ -0,0 +1,123 @@
+/*
+ *  Copyright (C) 2025-2026 mod.io Pty Ltd. <https://mod.io>
+ *
+ *  This file is part of the mod.io ModioUGC Plugin.
+ *
+ *  Distributed under the MIT License. (See accompanying file LICENSE or
+ *   view online at <https://github.com/modio/modio-ue-modiougc/blob/main/LICENSE>)
+ *
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/Runnable.h"
+#include "HAL/RunnableThread.h"
+#include "Templates/Function.h"
+#include "UGC/Types/GenericModID.h"
+
+#include <atomic>
+
+/**
+ * Verifies installed UGC again on a lowest priority thread, to catch disk corruption and partial updates before the
+ * damaged content is loaded.
+ *
+ * Each pass hashes the paks of every target again through FUGCContentVerifier::ReverifyFile, which refreshes the
+ * digest cache used when mounting, and checks that loose asset registries can still be read. Reads are limited to a
+ * maximum rate, and the pass sleeps while paused so it never competes with loading.
+ */
+class MODIOUGC_API FUGCBackgroundVerifier final : public FRunnable
+{
+public:
+	/**
+	 * Installed UGC to verify
+	 */
+	struct FTarget
+	{
+		/** Root directory of the UGC, as reported by the UGC provider */
+		FString UGCPath;
+		FGenericModID ModID;
+	};
+
+	/**
+	 * Installed UGC found damaged by a pass
+	 */
+	struct FDamagedUGC
+	{
+		FString UGCPath;
+		FGenericModID ModID;
+		TArray<FString> DamagedFiles;
+	};
+
+	/**
+	 * Called on the game thread when a pass completes, with the damaged UGC it found. Not called if the pass is stopped
+	 */
+	using FOnPassComplete = TUniqueFunction<void(TArray<FDamagedUGC> DamagedUGC)>;
+
+	explicit FUGCBackgroundVerifier(int64 InMaxBytesPerSecond);
+	virtual ~FUGCBackgroundVerifier() override;
+
+	/**
+	 * Starts a verification pass on a new thread
+	 *
+	 * @param InTargets The UGC to verify
+	 * @param InOnPassComplete Called on the game thread when the pass completes
+	 * @return false if a pass is already running
+	 */
+	bool StartPass(TArray<FTarget> InTargets, FOnPassComplete InOnPassComplete);
+
+	bool IsPassRunning() const
+	{
+		return bPassRunning;
+	}
+
+	/**
+	 * Pauses or resumes the running pass. The pass sleeps between reads while paused
+	 */
+	void SetPaused(bool bInPaused)
+	{
+		bPaused = bInPaused;
+	}
+
+	//~ Begin FRunnable Interface
+	virtual uint32 Run() override;
+	virtual void Stop() override;
+	//~ End FRunnable Interface
+
+private:
+	/**
+	 * Verifies the paks and loose asset registries of a single target
+	 *
+	 * @return false if the pass was stopped
+	 */
+	bool VerifyTarget(const FTarget& Target, TArray<FString>& OutDamagedFiles);
+
+	/**
+	 * Checks that the footer of a pak file can be read and that its index lies within the file. Used for paks without
+	 * a stored digest, whose content cannot be verified
+	 *
+	 * @return true if the pak looks intact
+	 */
+	static bool IsPakStructureValid(const FString& PakPath);
+
+	/**
+	 * Accounts for bytes read, sleeping to stay below the maximum read rate and while paused
+	 *
+	 * @return false if the pass was stopped
+	 */
+	bool Throttle(int64 BytesRead);
+
+	const int64 MaxBytesPerSecond;
+
+	TUniquePtr<FRunnableThread> Thread;
+	TArray<FTarget> Targets;
+	FOnPassComplete OnPassComplete;
+
+	std::atomic<bool> bPassRunning {false};
+	std::atomic<bool> bStopRequested {false};
+	std::atomic<bool> bPaused {false};
+
+	/** Start of the current throttling window and bytes read in it, only used on the verification thread */
+	double ThrottleWindowStart = 0.0;
+	int64 ThrottleWindowBytes = 0;
+};
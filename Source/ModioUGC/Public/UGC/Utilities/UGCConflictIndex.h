@@ -0,0 +1,92 @@
+/*
+ *  Copyright (C) 2025-2026 mod.io Pty Ltd. <https://mod.io>
+ *
+ *  This file is part of the mod.io ModioUGC Plugin.
+ *
+ *  Distributed under the MIT License. (See accompanying file LICENSE or
+ *   view online at <https://github.com/modio/modio-ue-modiougc/blob/main/LICENSE>)
+ *
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UGC/Types/UGCPackageConflict.h"
+
+/**
+ * Detects UGC packages that ship the same package names or pak file paths, or that shadow packages of the base game.
+ *
+ * Paths are stored as 64 bit hashes of their lower case form, mapped to the packages providing them. Conflicts are
+ * recorded per package pair as packages are added, so adding a package costs one hash lookup per path it ships.
+ */
+class MODIOUGC_API FUGCConflictIndex
+{
+public:
+	/**
+	 * Maximum number of example paths recorded per conflict
+	 */
+	static constexpr int32 MaxExampleConflictingPaths = 8;
+
+	/**
+	 * Adds the package names from the registry state and the paths from the file index of a mounted package
+	 *
+	 * @return Number of conflicts involving the package
+	 */
+	int32 AddPackage(const FUGCPackage& Package);
+
+	/**
+	 * Removes a package and the conflicts it is involved in
+	 */
+	void RemovePackage(const FUGCPackage& Package);
+
+	/**
+	 * Gets all the conflicts between the indexed packages
+	 */
+	TArray<FUGCPackageConflict> GetConflicts() const;
+
+	/**
+	 * Gets the conflicts a package is involved in
+	 */
+	TArray<FUGCPackageConflict> GetConflictsForPackage(const FUGCPackage& Package) const;
+
+	/**
+	 * Logs a summary of all conflicts
+	 */
+	void LogSummary() const;
+
+	SIZE_T GetAllocatedSize() const;
+
+private:
+	static uint64 HashPath(FStringView Path);
+
+	/**
+	 * Records a path shipped by both packages
+	 */
+	void AddConflictingPath(const FUGCPackage& Package, const FUGCPackage& OtherPackage, FStringView Path,
+							bool bIsPackageName);
+
+	/**
+	 * Gets the conflict between two packages, ordering them by load order
+	 */
+	FUGCPackageConflict& FindOrAddConflict(const FUGCPackage& A, const FUGCPackage& B);
+
+	struct FIndexedPackage
+	{
+		TArray<uint64> PackageNameHashes;
+		TArray<uint64> FileHashes;
+	};
+
+	using FPathOwners = TArray<FUGCPackage, TInlineAllocator<1>>;
+
+	/** Packages providing each package name */
+	TMap<uint64, FPathOwners> PackageNameOwners;
+
+	/** Packages providing each pak file path */
+	TMap<uint64, FPathOwners> FileOwners;
+
+	/** Hashes added by each package, so they can be removed again */
+	TMap<FUGCPackage, FIndexedPackage> IndexedPackages;
+
+	/** Conflicts between two UGC packages, keyed by the pair in load order, and conflicts with the base game */
+	TMap<TPair<FUGCPackage, FUGCPackage>, FUGCPackageConflict> Conflicts;
+};
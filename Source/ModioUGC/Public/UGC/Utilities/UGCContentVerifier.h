@@ -0,0 +1,165 @@
+/*
+ *  Copyright (C) 2025-2026 mod.io Pty Ltd. <https://mod.io>
+ *
+ *  This file is part of the mod.io ModioUGC Plugin.
+ *
+ *  Distributed under the MIT License. (See accompanying file LICENSE or
+ *   view online at <https://github.com/modio/modio-ue-modiougc/blob/main/LICENSE>)
+ *
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GenericPlatform/GenericPlatformFile.h"
+#include "Misc/DateTime.h"
+#include "Templates/Function.h"
+
+/**
+ * Result of verifying a single UGC content file
+ */
+enum class EUGCContentVerificationResult : uint8
+{
+	/** The content digest matches the stored digest */
+	Verified,
+	/** There is no stored digest to compare against */
+	NoStoredDigest,
+	/** The content digest does not match the stored digest, the file is damaged or incomplete */
+	Mismatch,
+	/** The file could not be read */
+	ReadError,
+	/** Verification was stopped before the whole file was read */
+	Cancelled
+};
+
+/**
+ * Verifies the integrity of installed UGC files (typically paks) before they are mounted.
+ *
+ * Files are hashed in fixed size chunks spread across worker threads, each chunk being streamed from disk rather than
+ * loaded whole. The chunk hashes are combined into a single content digest that is compared against the digest stored
+ * next to the file ("<File>.xxh64", see WriteStoredDigest). Digests are cached on disk keyed by file size and
+ * modification time, so unchanged files are only hashed once across sessions.
+ */
+class MODIOUGC_API FUGCContentVerifier
+{
+public:
+	/**
+	 * Size of the chunks a file is split into for hashing. Part of the digest format.
+	 */
+	static constexpr int64 ChunkSize = 4 * 1024 * 1024;
+
+	/**
+	 * Extension appended to a file path to locate its stored digest
+	 */
+	static const TCHAR* DigestFileExtension;
+
+	static FUGCContentVerifier& Get();
+
+	/**
+	 * Verifies a file against its stored digest, reusing the cached result if the file is unchanged
+	 *
+	 * @param FilePath Absolute path of the file to verify
+	 * @return The verification result
+	 */
+	EUGCContentVerificationResult VerifyFile(const FString& FilePath);
+
+	/**
+	 * Verifies a file against its stored digest by hashing it again, even if a result for the unchanged file is
+	 * cached. Used to detect damage that does not change the file size or modification time. The cache is updated with
+	 * the new digest, so later calls to VerifyFile report the result without hashing
+	 *
+	 * @param FilePath Absolute path of the file to verify
+	 * @param OnBlockRead Called after each block read with its size, e.g. to limit the read rate. Returning false
+	 * cancels verification
+	 * @return The verification result
+	 */
+	EUGCContentVerificationResult ReverifyFile(const FString& FilePath,
+											   TFunctionRef<bool(int64 BytesRead)> OnBlockRead);
+
+	/**
+	 * Gets the content digest of a file, reusing the cached digest if the file is unchanged
+	 *
+	 * @param FilePath Absolute path of the file
+	 * @param OutDigest The content digest
+	 * @return true if the digest could be computed
+	 */
+	bool GetFileDigest(const FString& FilePath, uint64& OutDigest);
+
+	/**
+	 * Computes the content digest of a file by hashing its chunks in parallel
+	 *
+	 * @param FilePath Absolute path of the file
+	 * @param OutDigest The content digest
+	 * @return true if the whole file could be read
+	 */
+	static bool ComputeFileDigest(const FString& FilePath, uint64& OutDigest);
+
+	/**
+	 * Computes the same content digest as ComputeFileDigest on the calling thread only, reading one block at a time
+	 *
+	 * @param FilePath Absolute path of the file
+	 * @param OnBlockRead Called after each block read with its size. Returning false stops hashing
+	 * @param OutDigest The content digest
+	 * @return true if the whole file could be read
+	 */
+	static bool ComputeFileDigestSequential(const FString& FilePath, TFunctionRef<bool(int64 BytesRead)> OnBlockRead,
+											uint64& OutDigest);
+
+	/**
+	 * Gets the files whose content is verified for a pak: the pak itself, followed by the IoStore container files
+	 * packaged next to it ("<Pak>.utoc" and "<Pak>.ucas") when they exist
+	 *
+	 * @param PakPath Absolute path of the pak file
+	 * @return The pak and its container files
+	 */
+	static TArray<FString> GetContentFilesForPak(const FString& PakPath);
+
+	/**
+	 * Reads the stored digest for a file
+	 *
+	 * @param FilePath Absolute path of the file
+	 * @param OutDigest The stored digest
+	 * @return true if a valid stored digest exists
+	 */
+	static bool LoadStoredDigest(const FString& FilePath, uint64& OutDigest);
+
+	/**
+	 * Computes the content digest of a file and stores it next to the file, for use when packaging UGC
+	 *
+	 * @param FilePath Absolute path of the file
+	 * @return true if the digest was written
+	 */
+	static bool WriteStoredDigest(const FString& FilePath);
+
+	/**
+	 * Writes the cache of verified files to disk if it has changed
+	 */
+	void SaveCache();
+
+private:
+	struct FCacheEntry
+	{
+		int64 Size = 0;
+		FDateTime Timestamp;
+		uint64 Digest = 0;
+	};
+
+	/**
+	 * Gets the digest of a file from the cache if the file is unchanged since it was cached, otherwise computes it and
+	 * updates the cache
+	 */
+	bool GetFileDigest(const FString& FilePath, const FFileStatData& StatData, uint64& OutDigest);
+
+	/**
+	 * Records the digest of a file in the cache
+	 */
+	void CacheDigest(const FString& FilePath, const FFileStatData& StatData, uint64 Digest);
+
+	void LoadCache();
+	static FString GetCacheFilePath();
+
+	FCriticalSection CacheLock;
+	TMap<FString, FCacheEntry> Cache;
+	bool bCacheLoaded = false;
+	bool bCacheDirty = false;
+};
@@ -0,0 +1,99 @@
+/*
+ *  Copyright (C) 2025-2026 mod.io Pty Ltd. <https://mod.io>
+ *
+ *  This file is part of the mod.io ModioUGC Plugin.
+ *
+ *  Distributed under the MIT License. (See accompanying file LICENSE or
+ *   view online at <https://github.com/modio/modio-ue-modiougc/blob/main/LICENSE>)
+ *
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Templates/Function.h"
+#include "UGC/Types/UGCPackageDependencyIssue.h"
+
+/**
+ * Dependency graph of the UGC packages about to be mounted, resolved into waves of packages in topological order.
+ *
+ * Every package of a wave only depends on packages of earlier waves or on plugins outside the graph, so the packages
+ * of a wave are independent of each other. Packages with missing dependencies, packages in a dependency cycle and
+ * packages depending on either are left out of the waves and reported as issues instead.
+ */
+class MODIOUGC_API FUGCDependencyGraph
+{
+public:
+	/**
+	 * Adds a package to the graph
+	 *
+	 * @param PluginName Name of the plugin of the package, which other packages refer to
+	 * @param DescriptorPath Path to the .uplugin of the package, for reporting
+	 * @param Dependencies Names of the plugins the package requires
+	 * @return Index of the package in the graph
+	 */
+	int32 AddPackage(const FString& PluginName, const FString& DescriptorPath, TArray<FString> Dependencies);
+
+	/**
+	 * Resolves the dependencies of every package added so far into waves and issues
+	 *
+	 * @param IsAvailableOutsideGraph Whether a plugin that is not in the graph satisfies a dependency, e.g. because it
+	 * is an enabled plugin of the project or a UGC package that is already mounted
+	 */
+	void Resolve(TFunctionRef<bool(const FString& PluginName)> IsAvailableOutsideGraph);
+
+	/**
+	 * Gets the indices of the packages that can be mounted, grouped into waves in mount order
+	 */
+	const TArray<TArray<int32>>& GetWaves() const
+	{
+		return Waves;
+	}
+
+	/**
+	 * Gets the packages that cannot be mounted because of their dependencies
+	 */
+	const TArray<FUGCPackageDependencyIssue>& GetIssues() const
+	{
+		return Issues;
+	}
+
+	/**
+	 * Gets the indices of the packages of the graph a package depends on
+	 */
+	const TArray<int32>& GetDependencies(int32 PackageIndex) const
+	{
+		return Packages[PackageIndex].GraphDependencies;
+	}
+
+	int32 Num() const
+	{
+		return Packages.Num();
+	}
+
+private:
+	struct FPackage
+	{
+		FString PluginName;
+		FString DescriptorPath;
+		TArray<FString> Dependencies;
+		TArray<int32> GraphDependencies;
+		TArray<int32> Dependents;
+	};
+
+	void AddIssue(int32 PackageIndex, EUGCPackageDependencyIssueType IssueType, TArray<FString> Dependencies);
+
+	/**
+	 * Finds the dependency cycles among packages that could not be ordered, using Tarjan's strongly connected
+	 * components algorithm
+	 */
+	TArray<TArray<int32>> FindCycles(const TArray<int32>& UnorderedPackages) const;
+
+	TArray<FPackage> Packages;
+
+	/** Plugin names are case insensitive, like in the plugin manager */
+	TMap<FString, int32> PluginNameToPackageIndex;
+
+	TArray<TArray<int32>> Waves;
+	TArray<FUGCPackageDependencyIssue> Issues;
+};
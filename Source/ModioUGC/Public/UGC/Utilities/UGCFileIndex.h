@@ -0,0 +1,92 @@
+/*
+ *  Copyright (C) 2025-2026 mod.io Pty Ltd. <https://mod.io>
+ *
+ *  This file is part of the mod.io ModioUGC Plugin.
+ *
+ *  Distributed under the MIT License. (See accompanying file LICENSE or
+ *   view online at <https://github.com/modio/modio-ue-modiougc/blob/main/LICENSE>)
+ *
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Templates/Function.h"
+
+/**
+ * Compact, immutable index of the files contained in the pak files of a UGC package.
+ *
+ * File paths are stored UTF-8 encoded in a sorted string table using front coding: each entry only stores the bytes
+ * that differ from the previous entry, and every RestartInterval entries a full path is stored so lookups can binary
+ * search the restart points and then decode a single block. Paths are ordered and compared ignoring ASCII case, like
+ * paths in the pak platform file.
+ */
+class MODIOUGC_API FUGCFileIndex
+{
+public:
+	/**
+	 * Number of entries between two fully stored paths
+	 */
+	static constexpr int32 RestartInterval = 16;
+
+	FUGCFileIndex() = default;
+
+	/**
+	 * Builds the index from a list of file paths. Paths that only differ in case are stored once
+	 */
+	explicit FUGCFileIndex(const TArray<FString>& FilePaths);
+
+	/**
+	 * Whether the index contains a file path
+	 */
+	bool Contains(FStringView FilePath) const;
+
+	/**
+	 * Finds the file paths matching a wildcard (e.g. "/RedSpaceship/Maps/*.umap"). Only the entries sharing the literal
+	 * prefix of the wildcard are visited
+	 *
+	 * @param Wildcard Pattern using '*' and '?' wildcards, matched ignoring case
+	 * @param OutFilePaths Array the matching paths are appended to
+	 */
+	void FindMatches(FStringView Wildcard, TArray<FString>& OutFilePaths) const;
+
+	/**
+	 * Invokes a visitor on every file path in index order. Returning false from the visitor stops the iteration
+	 */
+	void ForEachFile(TFunctionRef<bool(FStringView FilePath)> Visitor) const;
+
+	int32 Num() const
+	{
+		return NumFiles;
+	}
+
+	/**
+	 * Gets the memory used by the index
+	 */
+	SIZE_T GetAllocatedSize() const;
+
+private:
+	/**
+	 * Decodes the entries starting at a restart point, passing each UTF-8 path to the visitor until it returns false or
+	 * the index ends
+	 */
+	void VisitFromRestart(int32 RestartIndex, TFunctionRef<bool(TArrayView<const uint8> Path)> Visitor) const;
+
+	/**
+	 * Gets the index of the last restart point whose path does not compare greater than the key
+	 */
+	int32 FindRestartForKey(TArrayView<const uint8> Key) const;
+
+	/**
+	 * Gets the fully stored path at a restart point
+	 */
+	TArrayView<const uint8> GetRestartPath(int32 RestartIndex) const;
+
+	/** Front coded entries: shared prefix length and suffix length as variable length integers, then the suffix */
+	TArray<uint8> Data;
+
+	/** Offsets into Data of every RestartInterval-th entry */
+	TArray<uint32> RestartOffsets;
+
+	int32 NumFiles = 0;
+};
@@ -0,0 +1,83 @@
+/*
+ *  Copyright (C) 2025-2026 mod.io Pty Ltd. <https://mod.io>
+ *
+ *  This file is part of the mod.io ModioUGC Plugin.
+ *
+ *  Distributed under the MIT License. (See accompanying file LICENSE or
+ *   view online at <https://github.com/modio/modio-ue-modiougc/blob/main/LICENSE>)
+ *
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class IAsyncReadFileHandle;
+class IAsyncReadRequest;
+class IPlugin;
+
+/**
+ * Issues read-ahead for UGC packages that are queued for mounting, so that their disk I/O overlaps with the CPU work of
+ * committing the package currently being mounted.
+ *
+ * The tail of each pak file (footer and index) and any loose AssetRegistry.bin are prefetched. On Linux this is done
+ * with posix_fadvise readahead hints; other platforms issue precache requests, which warm the file cache without
+ * returning the data. At most MaxReadsInFlight requests are outstanding: further ranges are queued and issued as
+ * earlier requests complete, and each request is released along with its file handle once it has completed.
+ * Outstanding requests are waited for when the prefetcher is destroyed.
+ */
+class MODIOUGC_API FUGCPakPrefetcher
+{
+public:
+	/**
+	 * Number of bytes read ahead from the end of each pak file. Pak files store their index right before the footer
+	 */
+	static constexpr int64 PakTailPrefetchSize = 4 * 1024 * 1024;
+
+	/**
+	 * Maximum number of asynchronous read requests, and open file handles, outstanding at once
+	 */
+	static constexpr int32 MaxReadsInFlight = 8;
+
+	FUGCPakPrefetcher() = default;
+	~FUGCPakPrefetcher();
+
+	FUGCPakPrefetcher(const FUGCPakPrefetcher&) = delete;
+	FUGCPakPrefetcher& operator=(const FUGCPakPrefetcher&) = delete;
+
+	/**
+	 * Issues read-ahead for the pak files and registry of a UGC plugin. Does nothing if the plugin was already
+	 * prefetched
+	 *
+	 * @param Plugin The UGC plugin that is about to be mounted
+	 */
+	void Prefetch(const TSharedRef<IPlugin>& Plugin);
+
+private:
+	/**
+	 * Issues read-ahead for a byte range of a file, or queues it while too many reads are in flight
+	 */
+	void PrefetchFileRange(const FString& FilePath, int64 Offset, int64 Size);
+
+	/**
+	 * Releases the completed requests and their handles, then issues queued ranges while below MaxReadsInFlight
+	 */
+	void IssueQueuedReads();
+
+	struct FFileRange
+	{
+		FString FilePath;
+		int64 Offset = 0;
+		int64 Size = 0;
+	};
+
+	struct FPendingRead
+	{
+		IAsyncReadFileHandle* Handle = nullptr;
+		IAsyncReadRequest* Request = nullptr;
+	};
+
+	TArray<FPendingRead> PendingReads;
+	TArray<FFileRange> QueuedRanges;
+	TSet<FString> PrefetchedPlugins;
+};
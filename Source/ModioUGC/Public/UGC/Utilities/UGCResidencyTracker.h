@@ -0,0 +1,107 @@
+/*
+ *  Copyright (C) 2025-2026 mod.io Pty Ltd. <https://mod.io>
+ *
+ *  This file is part of the mod.io ModioUGC Plugin.
+ *
+ *  Distributed under the MIT License. (See accompanying file LICENSE or
+ *   view online at <https://github.com/modio/modio-ue-modiougc/blob/main/LICENSE>)
+ *
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UGC/Types/GenericModID.h"
+
+/**
+ * Bookkeeping of the UGC residency manager: last use time and pins of resident packages, and what is needed to mount
+ * evicted packages again. Packages are identified by their descriptor path, which stays the same across remounts.
+ *
+ * Last use times are updated from package load requests on any thread, so all members are guarded by a lock.
+ */
+class MODIOUGC_API FUGCResidencyTracker
+{
+public:
+	/**
+	 * A package that was unloaded to stay within the memory budget
+	 */
+	struct FEvictedPackage
+	{
+		FString DescriptorPath;
+
+		/** Mount root of the package (e.g. "/RedSpaceship"), used to remount it when content is requested from it */
+		FName MountRoot;
+
+		TOptional<FGenericModID> ModID;
+		int32 LoadPriority = 0;
+	};
+
+	/**
+	 * Starts tracking a mounted package, marking it as just used
+	 */
+	void AddResident(FName DescriptorPath);
+
+	/**
+	 * Stops tracking a package that was unmounted. Pins are kept so pinned packages stay pinned when remounted
+	 */
+	void RemoveResident(FName DescriptorPath);
+
+	/**
+	 * Marks a resident package as just used
+	 */
+	void Touch(FName DescriptorPath);
+
+	/**
+	 * Pins a package so it is never evicted. Pins are counted, so each Pin must be matched by an Unpin
+	 */
+	void Pin(FName DescriptorPath);
+
+	/**
+	 * Releases a pin
+	 *
+	 * @return false if the package was not pinned
+	 */
+	bool Unpin(FName DescriptorPath);
+
+	bool IsPinned(FName DescriptorPath) const;
+
+	/**
+	 * Gets the resident packages that are not pinned, least recently used first
+	 */
+	TArray<FName> GetEvictionOrder() const;
+
+	void AddEvicted(FEvictedPackage&& EvictedPackage);
+
+	/**
+	 * Takes the evicted package owning a mount root, if any
+	 */
+	TOptional<FEvictedPackage> TakeEvictedByMountRoot(FName MountRoot);
+
+	/**
+	 * Takes the evicted package associated with a mod ID, if any
+	 */
+	TOptional<FEvictedPackage> TakeEvictedByModID(FGenericModID ModID);
+
+	/**
+	 * Forgets the evicted packages associated with a mod ID, e.g. when the mod is about to be updated or uninstalled
+	 */
+	void RemoveEvictedByModID(FGenericModID ModID);
+
+	bool IsEvicted(FGenericModID ModID) const;
+
+	/**
+	 * Forgets all evicted packages, e.g. when every installed package is mounted again
+	 */
+	void EmptyEvicted();
+
+private:
+	mutable FCriticalSection Lock;
+
+	/** Last use time of resident packages, in FPlatformTime::Seconds */
+	TMap<FName, double> LastUseTimes;
+
+	TMap<FName, int32> PinCounts;
+
+	/** Evicted packages keyed by mount root */
+	TMap<FName, FEvictedPackage> EvictedPackages;
+};
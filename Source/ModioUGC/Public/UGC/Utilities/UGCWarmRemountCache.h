@@ -0,0 +1,79 @@
+/*
+ *  Copyright (C) 2025-2026 mod.io Pty Ltd. <https://mod.io>
+ *
+ *  This file is part of the mod.io ModioUGC Plugin.
+ *
+ *  Distributed under the MIT License. (See accompanying file LICENSE or
+ *   view online at <https://github.com/modio/modio-ue-modiougc/blob/main/LICENSE>)
+ *
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GenericPlatform/GenericPlatformFile.h"
+
+class FAssetRegistryState;
+class FUGCFileIndex;
+struct FUGCPackage;
+
+/**
+ * Data of an unmounted UGC package that can be reused when the package is mounted again
+ */
+struct FUGCWarmRemountEntry
+{
+	/** Paks that were mounted, and their size and modification time at the time */
+	TArray<FString> PakPaths;
+	TArray<FFileStatData> PakStats;
+
+	TSharedPtr<FAssetRegistryState> RegistryState;
+	TSharedPtr<const FUGCFileIndex> FileIndex;
+
+	SIZE_T AllocatedSize = 0;
+	double RetainTime = 0.0;
+};
+
+/**
+ * Retains the loaded asset registry state and file index of recently unmounted UGC packages, so that mounting them
+ * again (e.g. when a mod is toggled off and on, or on RefreshUGC) skips loading and parsing the registry, capturing the
+ * pak file lists and verifying the paks. Entries are only reused if the package has the same pak files with the same
+ * size and modification time, and the least recently retained entries are evicted to stay within the memory budget.
+ */
+class MODIOUGC_API FUGCWarmRemountCache
+{
+public:
+	static FUGCWarmRemountCache& Get();
+
+	/**
+	 * Retains the mount data of a package that is about to be unmounted. Does nothing if the package has no loaded
+	 * registry state or does not fit the budget
+	 *
+	 * @param Package The package being unmounted
+	 * @param BudgetBytes Maximum memory used by all retained entries
+	 */
+	void Retain(const FUGCPackage& Package, SIZE_T BudgetBytes);
+
+	/**
+	 * Takes the retained data for a package being mounted. The entry is removed whether or not it is still valid
+	 *
+	 * @param DescriptorPath Descriptor path of the package
+	 * @param PakPaths Sorted paks found for the package
+	 * @return The entry if the paks are unchanged since it was retained
+	 */
+	TOptional<FUGCWarmRemountEntry> Take(FName DescriptorPath, const TArray<FString>& PakPaths);
+
+	/**
+	 * Drops all retained entries
+	 */
+	void Empty();
+
+	int32 Num() const;
+	SIZE_T GetRetainedSize() const;
+
+private:
+	void EvictToBudget(SIZE_T BudgetBytes);
+
+	mutable FCriticalSection Lock;
+	TMap<FName, FUGCWarmRemountEntry> Entries;
+	SIZE_T RetainedSize = 0;
+};
@@ -22,6 +22,7 @@
 #include "Settings/PlatformsMenuSettings.h"
 #include "Settings/ProjectPackagingSettings.h"
 #include "UGC/Types/UGC_Metadata.h"
+#include "UGC/Utilities/UGCContentVerifier.h"
 #include "UObject/SavePackage.h"
 #include "Widgets/SWidget.h"
 #include "Widgets/SWindow.h"
@@ -672,6 +673,22 @@ void FModioUGCPackager::PostPackagePlugin(bool bSucceeded)
 			   *ContentDirectory_CopyTo);
 	}
 
+	// Store a content digest next to each pak and IoStore container so that the runtime can verify them before mounting
+	{
+		TArray<FString> PakFiles;
+		PlatformFile.FindFilesRecursively(PakFiles, *ContentDirectory_CopyTo, TEXT(".pak"));
+		for (const FString& PakFile : PakFiles)
+		{
+			for (const FString& ContentFile : FUGCContentVerifier::GetContentFilesForPak(PakFile))
+			{
+				if (!FUGCContentVerifier::WriteStoredDigest(ContentFile))
+				{
+					UE_LOG(ModioUGCEditor, Warning, TEXT("Failed to write content digest for '%s'"), *ContentFile);
+				}
+			}
+		}
+	}
+
 	// Delete the staging directory
 	PlatformFile.DeleteDirectoryRecursively(*StagingDirectory);
 
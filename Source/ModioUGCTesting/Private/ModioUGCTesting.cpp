@@ -0,0 +1,29 @@
+/*
+ *  Copyright (C) 2025-2026 mod.io Pty Ltd. <https://mod.io>
+ *
+ *  This file is part of the mod.io ModioUGC Plugin.
+ *
+ *  Distributed under the MIT License. (See accompanying file LICENSE or
+ *   view online at <https://github.com/modio/modio-ue-modiougc/blob/main/LICENSE>)
+ *
+ */
+
+#include "ModioUGCTesting.h"
+
+#define LOCTEXT_NAMESPACE "FModioUGCTestingModule"
+
+DEFINE_LOG_CATEGORY(LogModioUGCTesting)
+
+void FModioUGCTestingModule::StartupModule()
+{
+	UE_LOG(LogModioUGCTesting, Display, TEXT("ModioUGCTesting module has been loaded"));
+}
+
+void FModioUGCTestingModule::ShutdownModule()
+{
+	UE_LOG(LogModioUGCTesting, Display, TEXT("ModioUGCTesting module has been unloaded"));
+}
+
+#undef LOCTEXT_NAMESPACE
+
+IMPLEMENT_MODULE(FModioUGCTestingModule, ModioUGCTesting)
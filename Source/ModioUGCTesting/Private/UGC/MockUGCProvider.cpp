@@ -0,0 +1,240 @@
+/*
+ *  Copyright (C) 2025-2026 mod.io Pty Ltd. <https://mod.io>
+ *
+ *  This file is part of the mod.io ModioUGC Plugin.
+ *
+ *  Distributed under the MIT License. (See accompanying file LICENSE or
+ *   view online at <https://github.com/modio/modio-ue-modiougc/blob/main/LICENSE>)
+ *
+ */
+
+#include "UGC/MockUGCProvider.h"
+
+#include "Async/Async.h"
+#include "Containers/Ticker.h"
+#include "Engine/Engine.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/Paths.h"
+#include "ModioUGCTesting.h"
+#include "UGC/UGCSubsystem.h"
+
+TArray<FGenericModID> UMockUGCProvider::GetAvailableMods() const
+{
+	return Server ? Server->GetAvailableMods() : TArray<FGenericModID>();
+}
+
+bool UMockUGCProvider::InstallMod(FGenericModID ModID)
+{
+	if (!Server)
+	{
+		UE_LOG(LogModioUGCTesting, Warning, TEXT("Mock UGC provider is not initialized, cannot install mods"));
+		return false;
+	}
+	const FString FolderName = Server->GetModFolderName(ModID);
+	if (FolderName.IsEmpty() || PendingInstalls.Contains(ModID))
+	{
+		return false;
+	}
+
+	PendingInstalls.Add(ModID);
+	const double StartTime = FPlatformTime::Seconds();
+	HandleModEvent(ModID, EUGCModManagementEvent::BeginInstall, FString());
+	OnModEvent.Broadcast(ModID, EUGCModManagementEvent::BeginInstall, true, 0.0f);
+
+	const FString UGCPath = GetAbsoluteInstallDirectory() / FolderName;
+	Server->Download(ModID, UGCPath, [WeakThis = TWeakObjectPtr<UMockUGCProvider>(this), ModID, UGCPath,
+									  StartTime](bool bSuccess, const FString& Error) {
+		UMockUGCProvider* Provider = WeakThis.Get();
+		if (!Provider)
+		{
+			return;
+		}
+		Provider->PendingInstalls.Remove(ModID);
+
+		const double DownloadTime = FPlatformTime::Seconds();
+		if (!bSuccess)
+		{
+			UE_LOG(LogModioUGCTesting, Warning, TEXT("Mock install of '%s' failed: %s"), *UGCPath, *Error);
+		}
+		else
+		{
+			// Like a mod.io update, an existing install is unloaded before its files are replaced
+			const bool bIsUpdate = IFileManager::Get().DirectoryExists(*UGCPath);
+			if (bIsUpdate)
+			{
+				Provider->HandleModEvent(ModID, EUGCModManagementEvent::BeginUpdate, UGCPath);
+			}
+
+			const FString InstallError = FUGCLocalContentServer::InstallDownload(UGCPath);
+			if (!InstallError.IsEmpty())
+			{
+				UE_LOG(LogModioUGCTesting, Warning, TEXT("Mock install of '%s' failed: %s"), *UGCPath, *InstallError);
+			}
+
+			// Whatever is installed afterwards is mounted, including the previous version if it could not be replaced
+			const FString InstalledPath = IFileManager::Get().DirectoryExists(*UGCPath) ? UGCPath : FString();
+			const bool bMounted = Provider->HandleModEvent(
+				ModID, bIsUpdate ? EUGCModManagementEvent::Updated : EUGCModManagementEvent::Installed, InstalledPath);
+			bSuccess = InstallError.IsEmpty() && bMounted;
+		}
+
+		const double EndTime = FPlatformTime::Seconds();
+		UE_LOG(LogModioUGCTesting, Log, TEXT("Mock install of '%s' %s in %.1f ms (download %.1f ms, mount %.1f ms)"),
+			   *UGCPath, bSuccess ? TEXT("completed") : TEXT("failed"), (EndTime - StartTime) * 1000.0,
+			   (DownloadTime - StartTime) * 1000.0, (EndTime - DownloadTime) * 1000.0);
+		Provider->OnModEvent.Broadcast(ModID, EUGCModManagementEvent::Installed, bSuccess, EndTime - StartTime);
+	});
+	return true;
+}
+
+bool UMockUGCProvider::UninstallMod(FGenericModID ModID)
+{
+	const FString FolderName = Server ? Server->GetModFolderName(ModID) : FString();
+	const FString UGCPath = GetAbsoluteInstallDirectory() / FolderName;
+	if (FolderName.IsEmpty() || PendingInstalls.Contains(ModID) || !IFileManager::Get().DirectoryExists(*UGCPath))
+	{
+		return false;
+	}
+
+	const double StartTime = FPlatformTime::Seconds();
+	OnModEvent.Broadcast(ModID, EUGCModManagementEvent::BeginUninstall, true, 0.0f);
+
+	// Pak files must be unloaded before they can be deleted
+	HandleModEvent(ModID, EUGCModManagementEvent::BeginUninstall, UGCPath);
+	const bool bSuccess = IFileManager::Get().DeleteDirectory(*UGCPath, false, true);
+	HandleModEvent(ModID, EUGCModManagementEvent::Uninstalled, UGCPath);
+
+	const double EndTime = FPlatformTime::Seconds();
+	UE_LOG(LogModioUGCTesting, Log, TEXT("Mock uninstall of '%s' %s in %.1f ms"), *UGCPath,
+		   bSuccess ? TEXT("completed") : TEXT("failed"), (EndTime - StartTime) * 1000.0);
+	OnModEvent.Broadcast(ModID, EUGCModManagementEvent::Uninstalled, bSuccess, EndTime - StartTime);
+	return bSuccess;
+}
+
+bool UMockUGCProvider::HandleModEvent(FGenericModID ModID, EUGCModManagementEvent Event, const FString& UGCPath)
+{
+	// UGC of installed mods may also have been mounted by a refresh, so it is always unloaded before its files change
+	const bool bMountsUGC = Event == EUGCModManagementEvent::Installed || Event == EUGCModManagementEvent::Updated;
+	UUGCSubsystem* UGCSubsystem = GEngine ? GEngine->GetEngineSubsystem<UUGCSubsystem>() : nullptr;
+	if (!UGCSubsystem || (bMountsUGC && !bMountOnInstall))
+	{
+		return true;
+	}
+	return UGCSubsystem->HandleModManagementEvent(ModID, Event, [&UGCPath]() { return UGCPath; });
+}
+
+void UMockUGCProvider::InitializeProvider_Implementation(const FOnUGCProviderInitializedDelegate& Handler)
+{
+	auto CompleteInitialization = [this, Handler]() {
+		if (!bFailInitialization)
+		{
+			Server = MakeShared<FUGCLocalContentServer, ESPMode::ThreadSafe>(ServerSettings);
+			IFileManager::Get().MakeDirectory(*GetAbsoluteInstallDirectory(), true);
+		}
+		UE_LOG(LogModioUGCTesting, Log, TEXT("Mock UGC provider initialization %s"),
+			   bFailInitialization ? TEXT("failed") : TEXT("succeeded"));
+		Handler.ExecuteIfBound(!bFailInitialization);
+	};
+
+	if (InitializationLatencySeconds <= 0.0f)
+	{
+		CompleteInitialization();
+		return;
+	}
+	FTSTicker::GetCoreTicker().AddTicker(
+		FTickerDelegate::CreateWeakLambda(this,
+										  [CompleteInitialization](float) {
+											  CompleteInitialization();
+											  return false;
+										  }),
+		InitializationLatencySeconds);
+}
+
+void UMockUGCProvider::DeinitializeProvider_Implementation(const FOnUGCProviderDeinitializedDelegate& Handler)
+{
+	// Downloads in flight keep the server alive, and their results are ignored once the provider is gone
+	Server.Reset();
+	PendingInstalls.Reset();
+	Handler.ExecuteIfBound(true);
+}
+
+bool UMockUGCProvider::IsProviderEnabled_Implementation()
+{
+	return true;
+}
+
+FModUGCPathMap UMockUGCProvider::GetInstalledUGCPaths_Implementation()
+{
+	if (QueryLatencySeconds > 0.0f)
+	{
+		FPlatformProcess::Sleep(QueryLatencySeconds);
+	}
+	return ScanInstalledMods(GetAbsoluteInstallDirectory());
+}
+
+void UMockUGCProvider::ReportDamagedUGC_Implementation(const FString& UGCPath, FGenericModID ModID,
+														 const TArray<FString>& DamagedFiles)
+{
+	// Repair like a mod.io reinstall would: remove the damaged installation and download the mod again
+	UE_LOG(LogModioUGCTesting, Log, TEXT("Reinstalling damaged mock UGC '%s' (%d damaged files)"), *UGCPath,
+		   DamagedFiles.Num());
+	if (ModID == FGenericModID())
+	{
+		return;
+	}
+
+	// The damaged paks are still mounted and their assets may be loaded, so they are unloaded before their
+	// installation is deleted
+	if (UUGCSubsystem* UGCSubsystem = GEngine ? GEngine->GetEngineSubsystem<UUGCSubsystem>() : nullptr)
+	{
+		UGCSubsystem->UnloadUGCByModID(ModID);
+	}
+	if (UninstallMod(ModID))
+	{
+		InstallMod(ModID);
+	}
+}
+
+void UMockUGCProvider::GetInstalledUGCPathsAsync(FOnUGCPathsBatchDelegate OnBatch)
+{
+	Async(EAsyncExecution::ThreadPool, [WeakThis = TWeakObjectPtr<UMockUGCProvider>(this),
+										Directory = GetAbsoluteInstallDirectory(), Latency = QueryLatencySeconds,
+										OnBatch]() {
+		if (Latency > 0.0f)
+		{
+			FPlatformProcess::Sleep(Latency);
+		}
+		FModUGCPathMap UGCPathMap = ScanInstalledMods(Directory);
+		AsyncTask(ENamedThreads::GameThread, [WeakThis, OnBatch, UGCPathMap = MoveTemp(UGCPathMap)]() {
+			if (WeakThis.IsValid())
+			{
+				OnBatch.ExecuteIfBound(UGCPathMap, true);
+			}
+		});
+	});
+}
+
+FModUGCPathMap UMockUGCProvider::ScanInstalledMods(const FString& Directory)
+{
+	TArray<FString> FolderNames;
+	IFileManager::Get().FindFiles(FolderNames, *(Directory / TEXT("*")), false, true);
+
+	// Folders of downloads in progress don't parse as mod IDs
+	TMap<FString, FGenericModID> UGCPathsToModIDs;
+	for (const FString& FolderName : FolderNames)
+	{
+		const FGenericModID ModID = FUGCLocalContentServer::ParseModID(FolderName);
+		if (ModID != FGenericModID())
+		{
+			UGCPathsToModIDs.Add(Directory / FolderName, ModID);
+		}
+	}
+	return FModUGCPathMap(MoveTemp(UGCPathsToModIDs));
+}
+
+FString UMockUGCProvider::GetAbsoluteInstallDirectory() const
+{
+	return FPaths::ConvertRelativePathToFull(FPaths::ProjectDir(), InstallDirectory);
+}
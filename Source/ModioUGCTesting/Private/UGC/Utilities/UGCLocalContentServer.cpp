@@ -0,0 +1,218 @@
+/*
+ *  Copyright (C) 2025-2026 mod.io Pty Ltd. <https://mod.io>
+ *
+ *  This file is part of the mod.io ModioUGC Plugin.
+ *
+ *  Distributed under the MIT License. (See accompanying file LICENSE or
+ *   view online at <https://github.com/modio/modio-ue-modiougc/blob/main/LICENSE>)
+ *
+ */
+
+#include "UGC/Utilities/UGCLocalContentServer.h"
+
+#include "Async/Async.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
+#include "ModioUGCTesting.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "Templates/UniquePtr.h"
+
+namespace UGCLocalContentServer
+{
+	/** Size of the chunks files are copied in, which is also the granularity of the bandwidth limit */
+	constexpr int64 ChunkSize = 64 * 1024;
+} // namespace UGCLocalContentServer
+
+FUGCLocalContentServer::FUGCLocalContentServer(const FUGCLocalContentServerSettings& InSettings)
+	: Settings(InSettings),
+	  ContentDirectory(FPaths::ConvertRelativePathToFull(FPaths::ProjectDir(), InSettings.ContentDirectory)),
+	  RandomStream(InSettings.RandomSeed)
+{
+	RefreshAvailableMods();
+}
+
+void FUGCLocalContentServer::RefreshAvailableMods()
+{
+	TArray<FString> FolderNames;
+	IFileManager::Get().FindFiles(FolderNames, *(ContentDirectory / TEXT("*")), false, true);
+
+	FScopeLock ScopeLock(&Lock);
+	ModFolderNames.Reset();
+	for (FString& FolderName : FolderNames)
+	{
+		const FGenericModID ModID = ParseModID(FolderName);
+		if (ModID != FGenericModID())
+		{
+			ModFolderNames.Add(ModID, MoveTemp(FolderName));
+		}
+	}
+	UE_LOG(LogModioUGCTesting, Log, TEXT("Local content server serving %d mods from '%s'"), ModFolderNames.Num(),
+		   *ContentDirectory);
+}
+
+TArray<FGenericModID> FUGCLocalContentServer::GetAvailableMods() const
+{
+	FScopeLock ScopeLock(&Lock);
+	TArray<FGenericModID> ModIDs;
+	ModFolderNames.GenerateKeyArray(ModIDs);
+	ModIDs.Sort();
+	return ModIDs;
+}
+
+void FUGCLocalContentServer::Download(FGenericModID ModID, const FString& DestinationDirectory,
+									  FOnDownloadComplete OnComplete)
+{
+	FString SourceDirectory;
+	float FailAtFraction = -1.0f;
+	{
+		FScopeLock ScopeLock(&Lock);
+		if (const FString* FolderName = ModFolderNames.Find(ModID))
+		{
+			SourceDirectory = ContentDirectory / *FolderName;
+		}
+
+		// Failures are rolled when the download is requested, so they only depend on the order of the requests
+		if (RandomStream.FRand() < Settings.FailureRate)
+		{
+			FailAtFraction = RandomStream.FRand();
+		}
+	}
+
+	Async(EAsyncExecution::ThreadPool, [Server = AsShared(), SourceDirectory, DestinationDirectory, FailAtFraction,
+										OnComplete = MoveTemp(OnComplete)]() {
+		if (Server->Settings.LatencySeconds > 0.0f)
+		{
+			FPlatformProcess::Sleep(Server->Settings.LatencySeconds);
+		}
+
+		FString Error = SourceDirectory.IsEmpty()
+							? FString(TEXT("The server has no content for the mod"))
+							: Server->Transfer(SourceDirectory, DestinationDirectory, FailAtFraction);
+		AsyncTask(ENamedThreads::GameThread, [OnComplete, Error = MoveTemp(Error)]() {
+			if (OnComplete)
+			{
+				OnComplete(Error.IsEmpty(), Error);
+			}
+		});
+	});
+}
+
+FString FUGCLocalContentServer::GetModFolderName(FGenericModID ModID) const
+{
+	FScopeLock ScopeLock(&Lock);
+	const FString* FolderName = ModFolderNames.Find(ModID);
+	return FolderName ? *FolderName : FString();
+}
+
+FGenericModID FUGCLocalContentServer::ParseModID(const FString& FolderName)
+{
+	if (FolderName.IsEmpty())
+	{
+		return FGenericModID();
+	}
+	for (const TCHAR Char : FolderName)
+	{
+		if (!FChar::IsDigit(Char))
+		{
+			return FGenericModID();
+		}
+	}
+	return FGenericModID(FCString::Atoi64(*FolderName));
+}
+
+FString FUGCLocalContentServer::Transfer(const FString& SourceDirectory, const FString& DestinationDirectory,
+										 float FailAtFraction) const
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FUGCLocalContentServer::Transfer);
+	IFileManager& FileManager = IFileManager::Get();
+	if (!FileManager.DirectoryExists(*SourceDirectory))
+	{
+		return FString::Printf(TEXT("No content at '%s'"), *SourceDirectory);
+	}
+
+	TArray<FString> RelativeFilePaths;
+	FileManager.FindFilesRecursive(RelativeFilePaths, *SourceDirectory, TEXT("*"), true, false);
+	int64 TotalBytes = 0;
+	for (FString& FilePath : RelativeFilePaths)
+	{
+		TotalBytes += FileManager.FileSize(*FilePath);
+		FPaths::MakePathRelativeTo(FilePath, *(SourceDirectory / TEXT("")));
+	}
+
+	const int64 FailAtBytes = FailAtFraction >= 0.0f ? static_cast<int64>(TotalBytes * FailAtFraction) : -1;
+	const FString StagingDirectory = GetStagingDirectory(DestinationDirectory);
+	FileManager.DeleteDirectory(*StagingDirectory, false, true);
+
+	const double StartTime = FPlatformTime::Seconds();
+	int64 TransferredBytes = 0;
+	TArray<uint8> Chunk;
+	Chunk.SetNumUninitialized(UGCLocalContentServer::ChunkSize);
+	for (const FString& RelativeFilePath : RelativeFilePaths)
+	{
+		TUniquePtr<FArchive> Reader(FileManager.CreateFileReader(*(SourceDirectory / RelativeFilePath)));
+		TUniquePtr<FArchive> Writer(FileManager.CreateFileWriter(*(StagingDirectory / RelativeFilePath)));
+		if (!Reader || !Writer)
+		{
+			FileManager.DeleteDirectory(*StagingDirectory, false, true);
+			return FString::Printf(TEXT("Failed to copy '%s'"), *RelativeFilePath);
+		}
+
+		while (Reader->Tell() < Reader->TotalSize())
+		{
+			const int64 ChunkBytes = FMath::Min(UGCLocalContentServer::ChunkSize, Reader->TotalSize() - Reader->Tell());
+			if (FailAtBytes >= 0 && TransferredBytes + ChunkBytes > FailAtBytes)
+			{
+				Writer.Reset();
+				FileManager.DeleteDirectory(*StagingDirectory, false, true);
+				return FString::Printf(TEXT("Simulated failure after %lld of %lld bytes"), TransferredBytes,
+									   TotalBytes);
+			}
+
+			Reader->Serialize(Chunk.GetData(), ChunkBytes);
+			Writer->Serialize(Chunk.GetData(), ChunkBytes);
+			TransferredBytes += ChunkBytes;
+
+			// Wait until the transferred bytes fit the bandwidth
+			if (Settings.BandwidthBytesPerSecond > 0)
+			{
+				const double TargetTime =
+					StartTime + static_cast<double>(TransferredBytes) / Settings.BandwidthBytesPerSecond;
+				const double WaitTime = TargetTime - FPlatformTime::Seconds();
+				if (WaitTime > 0.0)
+				{
+					FPlatformProcess::Sleep(static_cast<float>(WaitTime));
+				}
+			}
+		}
+	}
+
+	UE_LOG(LogModioUGCTesting, Verbose, TEXT("Served %lld bytes from '%s' in %.1f ms"), TotalBytes, *SourceDirectory,
+		   (FPlatformTime::Seconds() - StartTime) * 1000.0);
+	return FString();
+}
+
+FString FUGCLocalContentServer::InstallDownload(const FString& DestinationDirectory)
+{
+	IFileManager& FileManager = IFileManager::Get();
+	const FString StagingDirectory = GetStagingDirectory(DestinationDirectory);
+	if (FileManager.DirectoryExists(*DestinationDirectory) &&
+		!FileManager.DeleteDirectory(*DestinationDirectory, false, true))
+	{
+		FileManager.DeleteDirectory(*StagingDirectory, false, true);
+		return FString::Printf(TEXT("Failed to remove the previous content of '%s'"), *DestinationDirectory);
+	}
+	if (!FileManager.Move(*DestinationDirectory, *StagingDirectory))
+	{
+		FileManager.DeleteDirectory(*StagingDirectory, false, true);
+		return FString::Printf(TEXT("Failed to move the content to '%s'"), *DestinationDirectory);
+	}
+	return FString();
+}
+
+FString FUGCLocalContentServer::GetStagingDirectory(const FString& DestinationDirectory)
+{
+	return DestinationDirectory + TEXT(".download");
+}
@@ -0,0 +1,172 @@
+/*
+ *  Copyright (C) 2025-2026 mod.io Pty Ltd. <https://mod.io>
+ *
+ *  This file is part of the mod.io ModioUGC Plugin.
+ *
+ *  Distributed under the MIT License. (See accompanying file LICENSE or
+ *   view online at <https://github.com/modio/modio-ue-modiougc/blob/main/LICENSE>)
+ *
+ */
+
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "IPlatformFilePak.h"
+#include "Math/RandomStream.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "ModioUGCTesting.h"
+#include "PakFileUtilities.h"
+#include "UGC/Types/UGCPackage.h"
+
+namespace UGCPakMountBenchmark
+{
+	/** Number of pak chunks the same generated content is split over */
+	const int32 ChunkCounts[] = {1, 8, 32};
+
+	constexpr int32 DefaultNumFiles = 4096;
+	constexpr int32 DefaultIterations = 5;
+	constexpr int32 GeneratedFileSize = 4 * 1024;
+
+	/** Number of directories the generated files are spread over, so the paks have a directory index to build */
+	constexpr int32 NumDirectories = 64;
+
+	const TCHAR* MountPoint = TEXT("../../../ModioUGCPakMountBenchmark/");
+
+	FString GetFixtureDirectory(int32 NumFiles, int32 NumChunks)
+	{
+		return FPaths::ConvertRelativePathToFull(FPaths::ProjectSavedDir() / TEXT("ModioUGCTesting") /
+												 TEXT("PakMountBenchmark") /
+												 FString::Printf(TEXT("%dFiles_%dChunks"), NumFiles, NumChunks));
+	}
+
+	/**
+	 * Splits NumFiles generated files over NumChunks paks created with UnrealPak. Paks generated by an earlier run are
+	 * reused, so the fixtures only have to be built once
+	 */
+	bool GenerateFixture(int32 NumFiles, int32 NumChunks, TArray<FString>& OutPakPaths)
+	{
+		IFileManager& FileManager = IFileManager::Get();
+		const FString FixtureDirectory = GetFixtureDirectory(NumFiles, NumChunks);
+		FRandomStream RandomStream(NumChunks);
+		TArray<uint8> FileContents;
+		FileContents.SetNumUninitialized(GeneratedFileSize);
+
+		for (int32 ChunkIndex = 0; ChunkIndex < NumChunks; ++ChunkIndex)
+		{
+			const FString PakPath = FixtureDirectory / FString::Printf(TEXT("pakchunk%d-Benchmark.pak"), ChunkIndex);
+			OutPakPaths.Add(PakPath);
+			if (FileManager.FileExists(*PakPath))
+			{
+				continue;
+			}
+
+			const FString SourceDirectory = FixtureDirectory / TEXT("Source") / FString::FromInt(ChunkIndex);
+			FString ResponseFile;
+			for (int32 FileIndex = ChunkIndex; FileIndex < NumFiles; FileIndex += NumChunks)
+			{
+				for (uint8& Byte : FileContents)
+				{
+					Byte = static_cast<uint8>(RandomStream.RandHelper(256));
+				}
+				const FString RelativePath =
+					FString::Printf(TEXT("Content/Dir%02d/File%05d.bin"), FileIndex % NumDirectories, FileIndex);
+				const FString SourcePath = SourceDirectory / RelativePath;
+				if (!FFileHelper::SaveArrayToFile(FileContents, *SourcePath))
+				{
+					UE_LOG(LogModioUGCTesting, Error, TEXT("Failed to write pak mount benchmark file %s"), *SourcePath);
+					return false;
+				}
+				ResponseFile += FString::Printf(TEXT("\"%s\" \"%s%s\"\n"), *SourcePath, MountPoint, *RelativePath);
+			}
+
+			const FString ResponseFilePath = SourceDirectory / TEXT("Response.txt");
+			if (!FFileHelper::SaveStringToFile(ResponseFile, *ResponseFilePath) ||
+				!ExecuteUnrealPak(*FString::Printf(TEXT("\"%s\" -create=\"%s\""), *PakPath, *ResponseFilePath)))
+			{
+				UE_LOG(LogModioUGCTesting, Error, TEXT("Failed to create pak mount benchmark pak %s"), *PakPath);
+				return false;
+			}
+			FileManager.DeleteDirectory(*SourceDirectory, false, true);
+		}
+		return true;
+	}
+
+	/**
+	 * Mounts the paks the way UGC packages do, then unmounts them again
+	 *
+	 * @return The time spent mounting in milliseconds, or a negative value if any pak failed to mount
+	 */
+	double TimeMount(const TArray<FString>& PakPaths, bool bPreloadInParallel)
+	{
+		FScopedPlatformPakFileOverride PakPlatformFile;
+		if (!PakPlatformFile.IsValid())
+		{
+			return -1.0;
+		}
+
+		TArray<bool> Mounted;
+		TArray<int64> PakIndexSizes;
+		const double StartTime = FPlatformTime::Seconds();
+		FUGCPackage::MountPakFilesInOrder(PakPlatformFile.Get(), PakPaths, MountPoint, FUGCPackage::DefaultPakReadOrder,
+										  bPreloadInParallel, Mounted, PakIndexSizes);
+		const double ElapsedMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+		for (int32 PakIndex = 0; PakIndex < PakPaths.Num(); ++PakIndex)
+		{
+			if (Mounted[PakIndex])
+			{
+				PakPlatformFile->Unmount(*PakPaths[PakIndex]);
+			}
+		}
+		return Mounted.Contains(false) ? -1.0 : ElapsedMs;
+	}
+
+	void Run(const TArray<FString>& Args, FOutputDevice& Ar)
+	{
+		const int32 NumFiles = Args.Num() > 0 ? FMath::Max(FCString::Atoi(*Args[0]), 1) : DefaultNumFiles;
+		const int32 Iterations = Args.Num() > 1 ? FMath::Max(FCString::Atoi(*Args[1]), 1) : DefaultIterations;
+
+		Ar.Logf(TEXT("UGC pak mount benchmark: %d files of %d bytes, %d iterations (average ms)"), NumFiles,
+				GeneratedFileSize, Iterations);
+		Ar.Logf(TEXT("%8s %10s %16s"), TEXT("Chunks"), TEXT("Serial"), TEXT("ParallelPreload"));
+		for (const int32 NumChunks : ChunkCounts)
+		{
+			TArray<FString> PakPaths;
+			if (!GenerateFixture(NumFiles, NumChunks, PakPaths))
+			{
+				Ar.Logf(TEXT("%8d failed to generate the fixture"), NumChunks);
+				continue;
+			}
+
+			// The first mount warms the file cache, so both modes are measured against the same cache state
+			TimeMount(PakPaths, false);
+			double SerialMs = 0.0;
+			double ParallelMs = 0.0;
+			bool bFailed = false;
+			for (int32 Iteration = 0; Iteration < Iterations && !bFailed; ++Iteration)
+			{
+				const double IterationSerialMs = TimeMount(PakPaths, false);
+				const double IterationParallelMs = TimeMount(PakPaths, true);
+				bFailed = IterationSerialMs < 0.0 || IterationParallelMs < 0.0;
+				SerialMs += IterationSerialMs;
+				ParallelMs += IterationParallelMs;
+			}
+
+			if (bFailed)
+			{
+				Ar.Logf(TEXT("%8d failed to mount the fixture paks"), NumChunks);
+				continue;
+			}
+			Ar.Logf(TEXT("%8d %10.2f %16.2f"), NumChunks, SerialMs / Iterations, ParallelMs / Iterations);
+		}
+		Ar.Logf(TEXT("Fixtures are kept in %s. Drop the OS file cache between runs to measure cold storage"),
+				*FPaths::GetPath(GetFixtureDirectory(NumFiles, 1)));
+	}
+} // namespace UGCPakMountBenchmark
+
+static FAutoConsoleCommandWithArgsAndOutputDevice GUGCBenchmarkPakMountCommand(
+	TEXT("ugc.benchmarkpakmount"),
+	TEXT("Times mounting generated 1, 8 and 32 chunk UGC paks serially and with parallel index preloading. Usage: "
+		 "ugc.benchmarkpakmount [NumFiles] [Iterations]"),
+	FConsoleCommandWithArgsAndOutputDeviceDelegate::CreateStatic(&UGCPakMountBenchmark::Run));
@@ -0,0 +1,30 @@
+/*
+ *  Copyright (C) 2025-2026 mod.io Pty Ltd. <https://mod.io>
+ *
+ *  This file is part of the mod.io ModioUGC Plugin.
+ *
+ *  Distributed under the MIT License. (See accompanying file LICENSE or
+ *   view online at <https://github.com/modio/modio-ue-modiougc/blob/main/LICENSE>)
+ *
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Modules/ModuleManager.h"
+
+DECLARE_LOG_CATEGORY_EXTERN(LogModioUGCTesting, Log, All);
+
+/**
+ * Test scaffolding for the UGC subsystem, such as the mock UGC provider and its local content server. Only built for
+ * development targets, so none of it ships
+ */
+class FModioUGCTestingModule : public IModuleInterface
+{
+public:
+	/* Called when the module is loaded */
+	virtual void StartupModule() override;
+
+	/* Called when the module is unloaded */
+	virtual void ShutdownModule() override;
+};
@@ -0,0 +1,134 @@
+/*
+ *  Copyright (C) 2025-2026 mod.io Pty Ltd. <https://mod.io>
+ *
+ *  This file is part of the mod.io ModioUGC Plugin.
+ *
+ *  Distributed under the MIT License. (See accompanying file LICENSE or
+ *   view online at <https://github.com/modio/modio-ue-modiougc/blob/main/LICENSE>)
+ *
+ */
+
+#pragma once
+
+#include "UGC/Types/UGCModManagementEvent.h"
+#include "UGC/UGCProvider.h"
+#include "UGC/Utilities/UGCLocalContentServer.h"
+#include "UObject/Object.h"
+
+#include "MockUGCProvider.generated.h"
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_FourParams(FOnMockUGCModEvent, FGenericModID, ModID, EUGCModManagementEvent,
+											  Event, bool, bSuccess, float, DurationSeconds);
+
+/**
+ * UGC provider installing mods from a local content server instead of mod.io, to test and benchmark install, mount and
+ * unmount flows deterministically without a network. Part of the ModioUGCTesting module, which is not built for
+ * shipping targets.
+ *
+ * Mods are installed to one folder per mod under the install directory. Each step of an install or uninstall is
+ * handled by UUGCSubsystem::HandleModManagementEvent, like the mod management events of mod.io, so installed and
+ * uninstalled mods are mounted and unloaded individually, including their loaded assets.
+ */
+UCLASS(BlueprintType)
+class MODIOUGCTESTING_API UMockUGCProvider : public UObject, public IUGCProvider
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	 * Simulated network conditions of the content server, applied when the provider is initialized
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "mod.io|UGC|Testing")
+	FUGCLocalContentServerSettings ServerSettings;
+
+	/**
+	 * Directory mods are installed to. Relative directories are relative to the project directory
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "mod.io|UGC|Testing")
+	FString InstallDirectory = TEXT("Saved/MockUGC");
+
+	/**
+	 * Delay before initialization completes, in seconds
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "mod.io|UGC|Testing", meta = (ClampMin = 0))
+	float InitializationLatencySeconds = 0.0f;
+
+	/**
+	 * Whether initialization fails, to test the handling of an unavailable provider
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "mod.io|UGC|Testing")
+	bool bFailInitialization = false;
+
+	/**
+	 * Delay of the installed UGC query, in seconds. Blocks the caller of the synchronous query
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "mod.io|UGC|Testing", meta = (ClampMin = 0))
+	float QueryLatencySeconds = 0.0f;
+
+	/**
+	 * Whether installed mods are mounted through the UGC subsystem. Mods are unloaded before their files are replaced
+	 * or deleted either way
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "mod.io|UGC|Testing")
+	bool bMountOnInstall = true;
+
+	/**
+	 * Broadcast for each step of an install or uninstall, with the time since the install or uninstall started
+	 */
+	UPROPERTY(BlueprintAssignable, Category = "mod.io|UGC|Testing")
+	FOnMockUGCModEvent OnModEvent;
+
+	/**
+	 * Gets the mods the content server has content for
+	 */
+	UFUNCTION(BlueprintCallable, Category = "mod.io|UGC|Testing")
+	TArray<FGenericModID> GetAvailableMods() const;
+
+	/**
+	 * Downloads a mod from the content server and mounts it
+	 * @return false if the provider is not initialized or the mod is already being installed
+	 */
+	UFUNCTION(BlueprintCallable, Category = "mod.io|UGC|Testing")
+	bool InstallMod(FGenericModID ModID);
+
+	/**
+	 * Unloads the UGC of a mod and deletes its installation
+	 * @return false if the mod is not installed or is being installed
+	 */
+	UFUNCTION(BlueprintCallable, Category = "mod.io|UGC|Testing")
+	bool UninstallMod(FGenericModID ModID);
+
+protected:
+	//~ Begin IUGCProvider Interface
+	virtual void InitializeProvider_Implementation(const FOnUGCProviderInitializedDelegate& Handler) override;
+	virtual void DeinitializeProvider_Implementation(const FOnUGCProviderDeinitializedDelegate& Handler) override;
+	virtual bool IsProviderEnabled_Implementation() override;
+	virtual FModUGCPathMap GetInstalledUGCPaths_Implementation() override;
+	virtual void ReportDamagedUGC_Implementation(const FString& UGCPath, FGenericModID ModID,
+												 const TArray<FString>& DamagedFiles) override;
+	//~ End IUGCProvider Interface
+
+public:
+	//~ Begin IUGCProvider Interface
+	virtual void GetInstalledUGCPathsAsync(FOnUGCPathsBatchDelegate OnBatch) override;
+	//~ End IUGCProvider Interface
+
+private:
+	/**
+	 * Lists the installed mods. Only touches the file system, so it can run on any thread
+	 */
+	static FModUGCPathMap ScanInstalledMods(const FString& Directory);
+
+	FString GetAbsoluteInstallDirectory() const;
+
+	/**
+	 * Mounts or unloads the mod for a step of an install or uninstall, the way mod management events are handled
+	 * @return false if UGC should have been mounted for the mod but none was
+	 */
+	bool HandleModEvent(FGenericModID ModID, EUGCModManagementEvent Event, const FString& UGCPath);
+
+	TSharedPtr<FUGCLocalContentServer, ESPMode::ThreadSafe> Server;
+
+	/** Mods being downloaded */
+	TSet<FGenericModID> PendingInstalls;
+};
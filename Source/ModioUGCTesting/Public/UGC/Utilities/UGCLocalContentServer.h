@@ -0,0 +1,143 @@
+/*
+ *  Copyright (C) 2025-2026 mod.io Pty Ltd. <https://mod.io>
+ *
+ *  This file is part of the mod.io ModioUGC Plugin.
+ *
+ *  Distributed under the MIT License. (See accompanying file LICENSE or
+ *   view online at <https://github.com/modio/modio-ue-modiougc/blob/main/LICENSE>)
+ *
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+#include "Math/RandomStream.h"
+#include "Templates/Function.h"
+#include "UGC/Types/GenericModID.h"
+
+#include "UGCLocalContentServer.generated.h"
+
+/**
+ * Network conditions simulated by a local content server
+ */
+USTRUCT(BlueprintType)
+struct MODIOUGCTESTING_API FUGCLocalContentServerSettings
+{
+	GENERATED_BODY()
+
+	/**
+	 * Directory holding the pre-generated UGC served, one folder per mod named after its mod ID (e.g. "1234"). Relative
+	 * directories are relative to the project directory
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "mod.io|UGC|Testing")
+	FString ContentDirectory = TEXT("MockUGCContent");
+
+	/**
+	 * Delay before a download starts transferring, in seconds
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "mod.io|UGC|Testing", meta = (ClampMin = 0))
+	float LatencySeconds = 0.1f;
+
+	/**
+	 * Transfer rate of a download, in bytes per second. 0 transfers as fast as the disk allows
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "mod.io|UGC|Testing", meta = (ClampMin = 0))
+	int64 BandwidthBytesPerSecond = 0;
+
+	/**
+	 * Probability of a download failing part way through, from 0 to 1
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "mod.io|UGC|Testing", meta = (ClampMin = 0, ClampMax = 1))
+	float FailureRate = 0.0f;
+
+	/**
+	 * Seed of the failures, so a sequence of downloads fails the same way on every run
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "mod.io|UGC|Testing")
+	int32 RandomSeed = 0;
+};
+
+/**
+ * Local stand-in for a UGC content server, serving pre-generated UGC from a directory without any network.
+ *
+ * Downloads copy the folder of a mod next to a destination directory on the thread pool, after the configured latency
+ * and at the configured bandwidth. The staged files are only moved in place by InstallDownload, so a simulated failure
+ * never leaves a partial install behind and an existing install can be unmounted before its files are replaced.
+ */
+class MODIOUGCTESTING_API FUGCLocalContentServer : public TSharedFromThis<FUGCLocalContentServer, ESPMode::ThreadSafe>
+{
+public:
+	/**
+	 * Called on the game thread when a download completes
+	 */
+	using FOnDownloadComplete = TFunction<void(bool bSuccess, const FString& Error)>;
+
+	explicit FUGCLocalContentServer(const FUGCLocalContentServerSettings& InSettings);
+
+	/**
+	 * Lists the content directory again, picking up mods added since the server was created
+	 */
+	void RefreshAvailableMods();
+
+	/**
+	 * Gets the mods the server has content for
+	 */
+	TArray<FGenericModID> GetAvailableMods() const;
+
+	/**
+	 * Downloads the content of a mod to the staging directory of a destination, leaving the destination untouched
+	 *
+	 * @param ModID ID of the mod to download
+	 * @param DestinationDirectory Directory the content of the mod is installed to by InstallDownload
+	 * @param OnComplete Called on the game thread once the download succeeded or failed
+	 */
+	void Download(FGenericModID ModID, const FString& DestinationDirectory, FOnDownloadComplete OnComplete);
+
+	/**
+	 * Replaces a destination directory with the content downloaded for it. Files of the destination must not be in
+	 * use, so UGC mounted from it has to be unmounted first
+	 *
+	 * @return An empty string on success, else the reason for the failure
+	 */
+	static FString InstallDownload(const FString& DestinationDirectory);
+
+	/**
+	 * Gets the name of the folder holding the content of a mod, which is its mod ID
+	 *
+	 * @return The folder name, or an empty string if the server has no content for the mod
+	 */
+	FString GetModFolderName(FGenericModID ModID) const;
+
+	/**
+	 * Parses a mod ID from a folder name made of the ID only
+	 *
+	 * @return The mod ID, or the default mod ID if the name is not a number
+	 */
+	static FGenericModID ParseModID(const FString& FolderName);
+
+private:
+	/**
+	 * Gets the directory the content downloaded for a destination is staged in
+	 */
+	static FString GetStagingDirectory(const FString& DestinationDirectory);
+
+	/**
+	 * Copies the content of a mod to the staging directory of the destination. Runs on the thread pool
+	 *
+	 * @param FailAtFraction Fraction of the bytes after which the transfer fails, or a negative value to succeed
+	 * @return An empty string on success, else the reason for the failure
+	 */
+	FString Transfer(const FString& SourceDirectory, const FString& DestinationDirectory, float FailAtFraction) const;
+
+	FUGCLocalContentServerSettings Settings;
+	FString ContentDirectory;
+
+	/** Guards ModFolderNames and RandomStream, as downloads may be started from several threads */
+	mutable FCriticalSection Lock;
+
+	/** Folder name of each mod the server has content for */
+	TMap<FGenericModID, FString> ModFolderNames;
+
+	FRandomStream RandomStream;
+};